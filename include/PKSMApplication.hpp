@@ -13,6 +13,7 @@
 #include "gui/screens/storage-screen/StorageScreen.hpp"
 #include "gui/screens/title-load-screen/TitleLoadScreen.hpp"
 #include "gui/shared/components/NotificationCenter.hpp"
+#include "utils/FrameTimeMonitor.hpp"
 
 namespace pksm {
 
@@ -36,6 +37,9 @@ private:
     // global toast notifications (drawn above everything)
     pksm::ui::NotificationCenter::Ref notificationCenter;
 
+    // Logs frames that miss the 60 FPS budget
+    pksm::utils::FrameTimeMonitor frameTimeMonitor;
+
     // Initialize renderer options with basic configuration
     static pu::ui::render::RendererInitOptions CreateRendererOptions();
 
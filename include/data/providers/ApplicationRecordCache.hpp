@@ -0,0 +1,53 @@
+#pragma once
+
+#include <mutex>
+#include <unordered_set>
+#include <vector>
+
+#include "data/providers/interfaces/IApplicationRecordSource.hpp"
+
+namespace pksm::titles {
+
+// Remembers which applications are installed, listing them again only after Invalidate or when the
+// source reports a change
+class ApplicationRecordCache {
+public:
+    explicit ApplicationRecordCache(IApplicationRecordSource::Ref source);
+
+    ApplicationRecordCache(const ApplicationRecordCache&) = delete;
+    ApplicationRecordCache& operator=(const ApplicationRecordCache&) = delete;
+
+    // List the applications again on the next query
+    void Invalidate();
+
+    bool IsInstalled(u64 titleId);
+
+    // Keep the items whose title id is installed, in their original order
+    template <typename T, typename GetTitleId>
+    std::vector<T> FilterInstalled(const std::vector<T>& items, GetTitleId getTitleId) {
+        std::lock_guard<std::mutex> lock(mutex);
+        RefreshIfStale();
+
+        std::vector<T> installed;
+        installed.reserve(items.size());
+        for (const auto& item : items) {
+            if (installedIds.contains(getTitleId(item))) {
+                installed.push_back(item);
+            }
+        }
+        return installed;
+    }
+
+private:
+    IApplicationRecordSource::Ref source;
+    std::mutex mutex;
+    std::unordered_set<u64> installedIds;
+    std::vector<u64> listBuffer;  // Reused between refreshes
+    u64 sequence = 0;
+    bool valid = false;
+
+    // Must be called with the mutex held
+    void RefreshIfStale();
+};
+
+}  // namespace pksm::titles
@@ -5,6 +5,7 @@
 #include <vector>
 
 #include "data/providers/interfaces/IBoxDataProvider.hpp"
+#include "data/providers/interfaces/ISaveDataAccessor.hpp"
 #include "data/saves/SaveData.hpp"
 #include "gui/shared/components/BoxPokemonData.hpp"
 
@@ -14,6 +15,10 @@ class Sav;
 
 class BoxDataProvider : public IBoxDataProvider {
 private:
+    // Source of the save that is currently loaded, whose parsed Sav is shared instead of read again
+    ISaveDataAccessor::Ref saveDataAccessor;
+
+    // Other saves are read here and kept until a different one is asked for
     mutable std::string cachedSaveName;
     mutable std::unique_ptr<pksm::Sav> cachedSav;
 
@@ -33,7 +38,7 @@ private:
     ) const;
 
 public:
-    BoxDataProvider();
+    explicit BoxDataProvider(ISaveDataAccessor::Ref saveDataAccessor = nullptr);
     ~BoxDataProvider() override;
 
     // IBoxDataProvider interface implementation
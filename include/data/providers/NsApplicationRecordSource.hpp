@@ -0,0 +1,35 @@
+#pragma once
+
+#include <switch.h>
+#include <vector>
+
+#include "data/providers/interfaces/IApplicationRecordSource.hpp"
+
+namespace pksm::titles {
+
+// Application records from the ns service, which stays open for the lifetime of the source
+class NsApplicationRecordSource : public IApplicationRecordSource {
+public:
+    NsApplicationRecordSource();
+    ~NsApplicationRecordSource() override;
+
+    NsApplicationRecordSource(const NsApplicationRecordSource&) = delete;
+    NsApplicationRecordSource& operator=(const NsApplicationRecordSource&) = delete;
+
+    bool ListApplicationIds(std::vector<u64>& outIds) override;
+
+    // Advances when ns signals that the application records changed
+    u64 GetChangeSequence() override;
+
+private:
+    // Records fetched per nsListApplicationRecord call
+    static constexpr s32 RECORDS_PER_CALL = 256;
+
+    bool nsReady = false;
+    bool hasUpdateEvent = false;
+    Event updateEvent{};
+    u64 sequence = 0;
+    std::vector<NsApplicationRecord> records;  // Reused between calls
+};
+
+}  // namespace pksm::titles
@@ -5,7 +5,9 @@
 #include <string>
 
 #include "data/providers/interfaces/ISaveDataAccessor.hpp"
+#include "data/providers/interfaces/ISaveMounter.hpp"
 #include "data/saves/SaveData.hpp"
+#include "data/saves/SaveWriter.hpp"
 #include "data/titles/Title.hpp"
 #include "utils/Logger.hpp"
 
@@ -14,19 +16,33 @@ using namespace pksm;
 class SaveDataAccessor : public ISaveDataAccessor {
 private:
     pksm::saves::SaveData::Ref currentSave;
+    // The parsed save behind currentSave, written back by saveChanges
+    std::unique_ptr<pksm::Sav> currentSav;
+    u64 currentTitleId;
     std::function<void(pksm::saves::SaveData::Ref)> onSaveDataChanged;
     bool hasChanges;
     AccountUid currentUserId;
+    // Mounts the console save a loaded save came from; the writer commits through the same mounter
+    ISaveMounter::Ref saveMounter;
+    pksm::saves::SaveWriter saveWriter;
+    // Where currentSav is written back to, with the save device replaced by the mounted root
+    std::string currentFilePath;
+    pksm::saves::SaveWriter::Destination currentDestination = pksm::saves::SaveWriter::Destination::SdCard;
+    // The user whose console save is mounted, which SetCurrentUser doesn't change
+    AccountUid mountedUserId{};
 
-    // Load actual save data from file
+    // Load actual save data from file, handing over the parsed save in loadedSav and the path it was
+    // read from in filePath. Console saves are mounted and stay mounted for later writes.
     pksm::saves::SaveData::Ref LoadSaveDataFromFile(
         const pksm::titles::Title::Ref& title,
-        const std::string& saveName
-    ) const;
+        const std::string& saveName,
+        std::unique_ptr<pksm::Sav>& loadedSav,
+        std::string& filePath
+    );
 
 public:
-    explicit SaveDataAccessor(AccountUid currentUserId);
-    virtual ~SaveDataAccessor() = default;
+    explicit SaveDataAccessor(AccountUid currentUserId, ISaveMounter::Ref saveMounter = nullptr);
+    virtual ~SaveDataAccessor();
 
     void SetCurrentUser(AccountUid userId) { 
         LOG_DEBUG("SaveDataAccessor: Changing user ID from " + std::to_string(currentUserId.uid[1]) + 
@@ -39,6 +55,7 @@ public:
 
     // ISaveDataAccessor interface implementation
     pksm::saves::SaveData::Ref getCurrentSaveData() const override;
+    pksm::Sav* getCurrentSav() const override { return currentSav.get(); }
     bool loadSave(const pksm::titles::Title::Ref title, const std::string saveName) override;
     void setOnSaveDataChanged(std::function<void(pksm::saves::SaveData::Ref)> callback) override {
         onSaveDataChanged = callback;
@@ -7,31 +7,27 @@
 #include <vector>
 
 #include "data/providers/interfaces/ISaveDataProvider.hpp"
+#include "data/providers/interfaces/ISaveMounter.hpp"
+#include "data/saves/BackupIndex.hpp"
 #include "data/saves/Save.hpp"
+#include "data/saves/SaveDiscovery.hpp"
 #include "data/titles/Title.hpp"
+#include "data/titles/TitleCatalogue.hpp"
 
 class SaveDataProvider : public ISaveDataProvider {
 private:
     AccountUid initialUserId;
-    static constexpr const char* JSON_PATH = "romfs:/gfx/data/data.json";
-    
-    // Cache for loaded titles to avoid repeated JSON parsing
-    mutable std::vector<std::pair<pksm::titles::Title::Ref, std::string>> cachedTitles;
-    mutable bool titlesLoaded = false;
-    
-    // Load installed console titles from JSON
-    std::vector<std::pair<pksm::titles::Title::Ref, std::string>> LoadInstalledTitles() const;
-    
-    // Check if save exists without mounting (faster check)
-    bool FastSaveCheck(const pksm::titles::Title::Ref& title, const AccountUid& uid, const std::string& mainSaveFile) const;
-    
-    // Find Checkpoint directory by partial title ID match
-    std::string FindCheckpointDirectory(const std::string& titleIdStr) const;
-    
-    // Extract zip file to temporary directory
-    std::string ExtractZipFile(const std::string& zipPath, const std::string& titleIdStr) const;
+
+    // Console titles and their main save files, shared with the title provider
+    pksm::titles::TitleCatalogue::Ref catalogue;
+
+    // Files in console saves, each save mounted once until the index is invalidated
+    mutable pksm::saves::SaveDiscovery saveDiscovery;
+
+    // Checkpoint and JKSV backups, scanned on a worker thread
+    pksm::saves::BackupIndex backupIndex;
     
-    // Scan for backup saves in Checkpoint/JKSV directories
+    // Get the backup saves of a title indexed so far
     std::vector<pksm::saves::Save::Ref> ScanBackupSaves(
         const pksm::titles::Title::Ref& title,
         const AccountUid& uid,
@@ -46,7 +42,8 @@ private:
     ) const;
 
 public:
-    explicit SaveDataProvider(const AccountUid& initialUserId);
+    // Saves are mounted on the "save" device unless another mounter is given
+    explicit SaveDataProvider(const AccountUid& initialUserId, ISaveMounter::Ref saveMounter = nullptr);
     virtual ~SaveDataProvider() = default;
 
     // Main function to get all saves for a user
@@ -63,4 +60,8 @@ public:
         const std::string& saveName,
         const AccountUid* userId = nullptr
     ) override;
+
+    void InvalidateSaveIndex() override;
+    void SetOnSavesChanged(std::function<void(u64 titleId)> callback) override;
+    void ProcessPendingUpdates() override;
 };
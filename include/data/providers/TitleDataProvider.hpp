@@ -3,10 +3,11 @@
 #include <vector>
 #include <memory>
 #include <string>
-#include <nlohmann/json.hpp>
 #include <switch/types.h> // for u64
-#include <set>
 #include "data/titles/Title.hpp"  // use the existing Title class
+#include "data/titles/TitleCatalogue.hpp"
+#include "data/providers/ApplicationRecordCache.hpp"
+#include "data/providers/interfaces/IApplicationRecordSource.hpp"
 #include "data/providers/interfaces/ITitleDataProvider.hpp"
 
 namespace pksm::titles {
@@ -15,16 +16,21 @@ class TitleDataProvider : public ITitleDataProvider {
 public:
     using Ref = std::shared_ptr<TitleDataProvider>;
 
-    TitleDataProvider(); // default constructor, loads JSON from fixed path
+    // Uses the shared title catalogue. Installed applications are listed through ns unless another
+    // record source is given.
+    explicit TitleDataProvider(IApplicationRecordSource::Ref recordSource = nullptr);
 
     std::vector<Title::Ref> GetInstalledTitles(const AccountUid& userId) const override;
     Title::Ref GetGameCardTitle() const override;
     std::vector<Title::Ref> GetEmulatorTitles() const override;
     std::vector<Title::Ref> GetCustomTitles() const override;
-    void GetInstalledApplicationIds(std::set<u64>& out_ids) const;
+
+    // List the installed applications again on the next GetInstalledTitles call
+    void InvalidateInstalledTitles();
 
 private:
-    std::vector<std::shared_ptr<Title>> installedTitles;
+    TitleCatalogue::Ref catalogue;
+    mutable ApplicationRecordCache installedApplications;
     std::vector<Title::Ref> customTitles;
 
     Title::Ref mockCartridgeTitle;
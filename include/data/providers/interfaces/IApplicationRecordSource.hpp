@@ -0,0 +1,19 @@
+#pragma once
+
+#include <memory>
+#include <switch/types.h>  // for u64
+#include <vector>
+
+// Lists the applications installed on the console
+class IApplicationRecordSource {
+public:
+    using Ref = std::shared_ptr<IApplicationRecordSource>;
+    virtual ~IApplicationRecordSource() = default;
+
+    // Replace outIds with the ids of all installed applications, returning false on failure
+    virtual bool ListApplicationIds(std::vector<u64>& outIds) = 0;
+
+    // A number that changes whenever applications are installed or removed, so callers can tell
+    // when a list they fetched earlier is out of date
+    virtual u64 GetChangeSequence() = 0;
+};
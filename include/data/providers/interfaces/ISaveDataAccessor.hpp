@@ -7,6 +7,10 @@
 #include "data/saves/SaveData.hpp"
 #include "data/titles/Title.hpp"
 
+namespace pksm {
+class Sav;
+}
+
 class ISaveDataAccessor {
 public:
     PU_SMART_CTOR(ISaveDataAccessor)
@@ -16,6 +20,10 @@ public:
     // Get the current save data
     virtual pksm::saves::SaveData::Ref getCurrentSaveData() const = 0;
 
+    // Get the parsed save behind the current save data, or nullptr if there is none. Valid until the
+    // next loadSave.
+    virtual pksm::Sav* getCurrentSav() const { return nullptr; }
+
     // Load a save data from a title and save name
     virtual bool loadSave(const pksm::titles::Title::Ref title, const std::string saveName) = 0;
 
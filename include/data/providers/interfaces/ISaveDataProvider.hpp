@@ -1,5 +1,6 @@
 #pragma once
 
+#include <functional>
 #include <memory>
 #include <optional>
 #include <string>
@@ -26,4 +27,14 @@ public:
         const std::string& saveName,
         const AccountUid* userId = nullptr
     ) = 0;
+
+    // Forget cached knowledge of which saves exist, e.g. after a save was written
+    virtual void InvalidateSaveIndex() {}
+
+    // Called when saves of a title were found after GetSavesForTitle returned, e.g. backups indexed
+    // in the background
+    virtual void SetOnSavesChanged(std::function<void(u64 titleId)> /*callback*/) {}
+
+    // Deliver pending OnSavesChanged calls. Must be called once per frame on the render thread.
+    virtual void ProcessPendingUpdates() {}
 };
\ No newline at end of file
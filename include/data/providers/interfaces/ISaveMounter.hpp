@@ -0,0 +1,23 @@
+#pragma once
+
+#include <memory>
+#include <optional>
+#include <string>
+#include <switch.h>
+
+// Mounts title saves so their files can be read and written. Only one save is mounted at a time.
+class ISaveMounter {
+public:
+    using Ref = std::shared_ptr<ISaveMounter>;
+    virtual ~ISaveMounter() = default;
+
+    // Mount the save of a title for a user, returning the path of its root directory (ending in a
+    // slash), or std::nullopt if the user has no save for the title
+    virtual std::optional<std::string> Mount(u64 titleId, const AccountUid& uid) = 0;
+
+    // Unmount the save mounted last. Writes that weren't committed are discarded.
+    virtual void Unmount() = 0;
+
+    // Commit everything written to the mounted save since it was mounted or last committed
+    virtual bool Commit() = 0;
+};
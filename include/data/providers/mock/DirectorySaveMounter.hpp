@@ -0,0 +1,55 @@
+#pragma once
+
+#include <cstdio>
+#include <filesystem>
+#include <string>
+#include <utility>
+
+#include "data/providers/interfaces/ISaveMounter.hpp"
+
+// Saves stored as plain directories, <root>/<title id>/<user id>/, so save discovery can run off
+// console. Ids are written as lowercase hex, the user id as its two halves back to back.
+class DirectorySaveMounter : public ISaveMounter {
+private:
+    std::string root;
+    size_t mountCount = 0;
+    size_t commitCount = 0;
+
+public:
+    explicit DirectorySaveMounter(std::string root) : root(std::move(root)) {}
+
+    std::optional<std::string> Mount(u64 titleId, const AccountUid& uid) override {
+        mountCount++;
+
+        char ids[64];
+        std::snprintf(
+            ids,
+            sizeof(ids),
+            "%016llx/%016llx%016llx",
+            static_cast<unsigned long long>(titleId),
+            static_cast<unsigned long long>(uid.uid[0]),
+            static_cast<unsigned long long>(uid.uid[1])
+        );
+
+        const std::string path = root + "/" + ids + "/";
+        std::error_code ec;
+        if (!std::filesystem::is_directory(path, ec)) {
+            return std::nullopt;
+        }
+        return path;
+    }
+
+    // Plain directories have no journal, so writes land immediately and commits do nothing
+    void Unmount() override {}
+
+    bool Commit() override {
+        commitCount++;
+        return true;
+    }
+
+    // How often a save was mounted, to check what the save index saves
+    size_t GetMountCount() const { return mountCount; }
+
+    // How often a save was committed, to check that a write commits once
+    size_t GetCommitCount() const { return commitCount; }
+};
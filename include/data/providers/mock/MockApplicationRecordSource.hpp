@@ -0,0 +1,35 @@
+#pragma once
+
+#include <utility>
+#include <vector>
+
+#include "data/providers/interfaces/IApplicationRecordSource.hpp"
+
+// Application records held in memory, so installed-title filtering can run off console
+class MockApplicationRecordSource : public IApplicationRecordSource {
+private:
+    std::vector<u64> applicationIds;
+    u64 sequence = 0;
+    size_t listCount = 0;
+
+public:
+    explicit MockApplicationRecordSource(std::vector<u64> applicationIds = {})
+      : applicationIds(std::move(applicationIds)) {}
+
+    bool ListApplicationIds(std::vector<u64>& outIds) override {
+        listCount++;
+        outIds = applicationIds;
+        return true;
+    }
+
+    u64 GetChangeSequence() override { return sequence; }
+
+    // Simulate installing or removing applications
+    void SetApplicationIds(std::vector<u64> ids) {
+        applicationIds = std::move(ids);
+        sequence++;
+    }
+
+    // How often the records were listed, to check what the cache saves
+    size_t GetListCount() const { return listCount; }
+};
@@ -0,0 +1,112 @@
+#pragma once
+
+#include <condition_variable>
+#include <functional>
+#include <map>
+#include <mutex>
+#include <set>
+#include <string>
+#include <switch/types.h>  // for u64
+#include <thread>
+#include <vector>
+
+namespace pksm::saves {
+
+// A save backup made by a backup manager such as Checkpoint or JKSV
+struct BackupInfo {
+    std::string label;  // Display prefix of the backup manager, e.g. "[JKSV]"
+    std::string name;   // Backup directory or zip file name
+    std::string path;   // Full path of the backup directory or zip file
+    bool isZip;
+    std::vector<std::string> files;  // Files at the top of a backup directory, or every file in a zip
+
+    bool HasFile(const std::string& file) const;
+};
+
+// Where a backup manager keeps its backups: one folder per title, named after its title id, each
+// holding one directory or zip file per backup
+struct BackupRoot {
+    std::string path;
+    std::string label;
+};
+
+// Index of the backups on the SD card, built on a worker thread. Every scan lists the roots and the
+// title folders, but the backups in a title folder are only read again when the names in that
+// folder change, which happens whenever a backup is added, removed or renamed. A backup overwritten
+// under the same name isn't read again (see GetListingSignature in BackupIndex.cpp). Directory
+// modification times can't be used: fsdev reports 0 for directories, and FAT doesn't keep them
+// reliably anyway.
+class BackupIndex {
+public:
+    // Called on the render thread, from ProcessUpdates, after a title's backups were indexed
+    using Listener = std::function<void(u64 titleId)>;
+
+    // Checkpoint and JKSV folders on the SD card
+    static std::vector<BackupRoot> DefaultRoots();
+
+    explicit BackupIndex(std::vector<BackupRoot> roots = DefaultRoots());
+    BackupIndex(const BackupIndex&) = delete;
+    BackupIndex& operator=(const BackupIndex&) = delete;
+
+    // Ensure the worker thread is stopped before the index goes away
+    ~BackupIndex();
+
+    // Scan for changes in the background. Requests made while a scan runs are merged into one more
+    // scan after it.
+    void Refresh();
+
+    // Block until no scan is pending or running
+    void WaitForScan();
+
+    // Backups of a title indexed so far, in root order
+    std::vector<BackupInfo> GetBackups(u64 titleId) const;
+
+    void SetListener(Listener listener);
+
+    // Tell the listener which titles got new results. Must be called on the render thread.
+    void ProcessUpdates();
+
+private:
+    struct FolderState {
+        size_t listingSignature;  // Hash of the sorted entry names
+        u64 titleId;
+        size_t rootIndex;
+        std::vector<BackupInfo> backups;
+    };
+
+    struct RootState {
+        std::vector<std::string> folders;  // Paths of the title folders
+    };
+
+    std::vector<BackupRoot> roots;
+
+    mutable std::mutex mutex;
+    std::condition_variable scanRequested;
+    std::condition_variable scanFinished;
+    std::thread worker;
+    bool stopping = false;
+    bool scanPending = false;
+    bool scanning = false;
+
+    // Guarded by mutex; the worker builds new states without the lock and swaps them in
+    std::map<std::string, FolderState> folders;  // By folder path
+    std::set<u64> updatedTitles;                // Not yet reported to the listener
+
+    // Only used by the worker
+    std::vector<RootState> rootStates;
+
+    Listener listener;  // Only used on the render thread
+
+    void WorkerLoop();
+
+    // Relist the root, then rescan the title folders whose entries changed
+    void ScanRoot(size_t rootIndex);
+
+    void ScanFolder(const std::string& folderPath, size_t listingSignature, u64 titleId, size_t rootIndex);
+};
+
+// Find the title id in a backup folder name: the first run of 16 hex digits, in either case. Returns
+// 0 if there is none.
+u64 ParseBackupFolderTitleId(const std::string& folderName);
+
+}  // namespace pksm::saves
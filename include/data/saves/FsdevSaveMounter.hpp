@@ -0,0 +1,15 @@
+#pragma once
+
+#include "data/providers/interfaces/ISaveMounter.hpp"
+
+namespace pksm::saves {
+
+// Mounts saves on the "save" device, replacing whatever is mounted there
+class FsdevSaveMounter : public ISaveMounter {
+public:
+    std::optional<std::string> Mount(u64 titleId, const AccountUid& uid) override;
+    void Unmount() override;
+    bool Commit() override;
+};
+
+}  // namespace pksm::saves
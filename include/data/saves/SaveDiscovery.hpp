@@ -0,0 +1,67 @@
+#pragma once
+
+#include <ctime>
+#include <map>
+#include <mutex>
+#include <string>
+#include <switch.h>
+#include <vector>
+
+#include "data/providers/interfaces/ISaveMounter.hpp"
+
+namespace pksm::saves {
+
+// A file inside a save
+struct SaveFileInfo {
+    std::string path;  // Relative to the save root, e.g. "main" or "backup/main"
+    u64 size;
+    std::time_t modified;
+};
+
+// What is known about one user's save for a title
+struct SaveIndexEntry {
+    bool exists = false;  // False if the save couldn't be mounted
+    std::string root;  // Where the mounter put the save's root directory, ending in a slash
+    std::vector<SaveFileInfo> files;
+
+    // Find a file by its path relative to the save root, returning nullptr if it isn't there
+    const SaveFileInfo* Find(const std::string& path) const;
+};
+
+// Index of the files in console saves. Each (title, user) save is mounted at most once, the first
+// time it is asked for, and the index is reused until Invalidate.
+class SaveDiscovery {
+public:
+    explicit SaveDiscovery(ISaveMounter::Ref mounter);
+
+    SaveDiscovery(const SaveDiscovery&) = delete;
+    SaveDiscovery& operator=(const SaveDiscovery&) = delete;
+
+    // Get the index entry for a title's save, mounting it if it hasn't been indexed yet
+    SaveIndexEntry Discover(u64 titleId, const AccountUid& uid);
+
+    // Forget everything, e.g. after saves were written
+    void Invalidate();
+
+    // Forget one save
+    void Invalidate(u64 titleId, const AccountUid& uid);
+
+private:
+    struct Key {
+        u64 titleId;
+        u64 uid[2];
+
+        bool operator<(const Key& other) const;
+    };
+
+    ISaveMounter::Ref mounter;
+    std::mutex mutex;
+    std::map<Key, SaveIndexEntry> index;
+
+    static Key MakeKey(u64 titleId, const AccountUid& uid);
+
+    // Mount a save and list its files
+    SaveIndexEntry IndexSave(u64 titleId, const AccountUid& uid);
+};
+
+}  // namespace pksm::saves
@@ -0,0 +1,47 @@
+#pragma once
+
+#include <chrono>
+#include <memory>
+#include <string>
+#include <switch/types.h>
+
+namespace pksm {
+class Sav;
+}
+
+namespace pksm::saves {
+
+// Reads saves into the buffer PKSM-Core parses, without an intermediate copy. Plain files are read
+// with unbuffered stdio in large chunks, zipped backups ("<archive>#<entry>") are inflated in place.
+// Console saves must already be mounted.
+class SaveReader {
+public:
+    // Where the time of one load went
+    struct Timing {
+        std::chrono::microseconds read{0};   // Opening and reading or inflating the file
+        std::chrono::microseconds parse{0};  // Sav::getSave
+        std::chrono::microseconds total{0};  // Time to the first parsed Sav
+        size_t bytes = 0;
+
+        // Read throughput in MB/s
+        double ReadThroughput() const;
+    };
+
+    // Read the file at path into a buffer of exactly its size. Returns nullptr if it can't be read.
+    static std::shared_ptr<u8[]> ReadFile(const std::string& path, size_t& size);
+
+    // Read and parse the save at path. Returns nullptr if it can't be read or isn't a known save.
+    static std::unique_ptr<pksm::Sav> Load(const std::string& path, Timing* timing = nullptr);
+
+    // Reads go to the final buffer in chunks of this size
+    static constexpr size_t READ_CHUNK_SIZE = 1024 * 1024;
+
+private:
+    static std::shared_ptr<u8[]> ReadArchiveEntry(
+        const std::string& archivePath,
+        const std::string& entryName,
+        size_t& size
+    );
+};
+
+}  // namespace pksm::saves
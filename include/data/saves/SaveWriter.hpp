@@ -0,0 +1,102 @@
+#pragma once
+
+#include <chrono>
+#include <string>
+#include <switch.h>
+
+#include "data/providers/interfaces/ISaveMounter.hpp"
+
+namespace pksm {
+class Sav;
+}
+
+namespace pksm::saves {
+
+// Writes edited saves back to where they were loaded from. Files in a console save are overwritten
+// in place and committed once through the mounter that mounted the save; the save file system's
+// journal makes the commit atomic. The writer never mounts or unmounts saves itself. Files on the
+// SD card are written to a temporary file and flushed to storage; the original is then moved aside
+// and only deleted once the new file has taken its place. If that is cut short, SaveReader puts the
+// new file back in place through RecoverInterruptedWrite.
+class SaveWriter {
+public:
+    // Where the time of one write went
+    struct Timing {
+        std::chrono::microseconds finishEditing{0};  // Checksums and encryption done by PKSM-Core
+        std::chrono::microseconds backup{0};
+        std::chrono::microseconds write{0};  // File write and flush, plus the rename on the SD card
+        std::chrono::microseconds commit{0};
+        std::chrono::microseconds total{0};
+        size_t bytes = 0;
+    };
+
+    // Where the file being written lives
+    enum class Destination {
+        SdCard,  // Replaced through a temporary file
+        MountedSave  // Overwritten in place, then the mounted save is committed
+    };
+
+    static constexpr const char* DEFAULT_BACKUP_ROOT = "sdmc:/switch/PKSM/backups";
+
+    // Prefix of paths to files in the mounted console save
+    static constexpr const char* SAVE_DEVICE_PREFIX = "save:/";
+
+    // Names of the new and the previous file next to a save while it is being replaced
+    static constexpr const char* TEMP_SUFFIX = ".tmp";
+    static constexpr const char* PREVIOUS_SUFFIX = ".old";
+
+    // Before a save is overwritten, a copy of it is kept under
+    // <backupRoot>/<title id>/<date>-<time>/<file name>. An empty backupRoot disables that.
+    explicit SaveWriter(ISaveMounter::Ref mounter, std::string backupRoot = DEFAULT_BACKUP_ROOT);
+
+    SaveWriter(const SaveWriter&) = delete;
+    SaveWriter& operator=(const SaveWriter&) = delete;
+
+    // Save names without a device, like "main", are files in the console save. Returns saveName
+    // with the save device prefix added in that case.
+    static std::string ResolveSavePath(const std::string& saveName);
+
+    static bool IsSaveDevicePath(const std::string& savePath);
+
+    // Ready sav for writing and write it to filePath, which has to be a real path: for a console save
+    // that is a path below the root returned when mounting it. Backups are filed under titleId. Saves
+    // inside zipped backups can't be written. Editing can continue afterwards either way.
+    bool Write(
+        pksm::Sav& sav,
+        u64 titleId,
+        const std::string& filePath,
+        Destination destination,
+        Timing* timing = nullptr
+    );
+
+    // Write an already serialized save, see Write. If writing to a mounted save fails, the caller
+    // should unmount it to throw away what was written so far.
+    bool WriteData(
+        const u8* data,
+        size_t size,
+        u64 titleId,
+        const std::string& filePath,
+        Destination destination,
+        Timing* timing = nullptr
+    );
+
+    // Replace the file at path with data through a temporary file next to it
+    static bool WriteFileAtomically(const std::string& path, const u8* data, size_t size);
+
+    // If path is missing because WriteFileAtomically was interrupted, move the newest complete copy
+    // back to path. Returns whether there is a file at path afterwards.
+    static bool RecoverInterruptedWrite(const std::string& path);
+
+    // Overwrite the file at path with data, for files in a save that is committed afterwards. Unlike
+    // WriteFileAtomically this needs no free space for a second copy of the file.
+    static bool WriteFileInPlace(const std::string& path, const u8* data, size_t size);
+
+private:
+    ISaveMounter::Ref mounter;
+    std::string backupRoot;
+
+    // Copy the file at path to a new backup directory, doing nothing if there is no file yet
+    bool BackupFile(const std::string& path, u64 titleId) const;
+};
+
+}  // namespace pksm::saves
@@ -5,35 +5,28 @@
 #include <pu/ui/render/render_Renderer.hpp>
 #include <string>
 
+#include "data/titles/TitleIconLoader.hpp"
+
 namespace pksm::titles {
 
 class Title {
 public:
-    Title(const std::string& name, const std::string& iconPath, u64 titleId) : name(name), titleId(titleId) {
-        // Load icon texture - handle gracefully if it fails
-        try {
-            auto image = pu::ui::render::LoadImage(iconPath);
-            if (image) {
-                iconTexture = pu::sdl2::TextureHandle::New(image);
-            } else {
-                // Icon failed to load, set to nullptr
-                iconTexture = nullptr;
-            }
-        } catch (...) {
-            // If icon loading fails, just set to nullptr
-            iconTexture = nullptr;
-        }
-    }
+    Title(const std::string& name, const std::string& iconPath, u64 titleId)
+      : name(name), iconPath(iconPath), titleId(titleId) {}
     PU_SMART_CTOR(Title)
 
     // Getters
     const std::string& getName() const { return name; }
+    const std::string& getIconPath() const { return iconPath; }
     u64 getTitleId() const { return titleId; }
-    pu::sdl2::TextureHandle::Ref getIcon() const { return iconTexture; }
+
+    // The icon is decoded in the background the first time it is asked for, so the texture may still
+    // be empty; images showing it update once it is loaded
+    pu::sdl2::TextureHandle::Ref getIcon() const { return TitleIconLoader::GetIcon(iconPath); }
 
 private:
     std::string name;
+    std::string iconPath;
     u64 titleId;
-    pu::sdl2::TextureHandle::Ref iconTexture;
 };
-}  // namespace pksm::titles
\ No newline at end of file
+}  // namespace pksm::titles
@@ -0,0 +1,42 @@
+#pragma once
+
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "data/titles/Title.hpp"
+
+namespace pksm::titles {
+
+// The console titles PKSM supports, read once from romfs and shared by every provider. Immutable
+// after loading, so it can be used from any thread.
+class TitleCatalogue {
+public:
+    using Ref = std::shared_ptr<const TitleCatalogue>;
+
+    struct Entry {
+        Title::Ref title;
+        std::string mainSaveFile;  // Empty if the whole save directory should be scanned
+    };
+
+    // Precompiled by tools/pack_title_catalogue.py; data.json is parsed if it is missing
+    static constexpr const char* CATALOGUE_PATH = "romfs:/gfx/data/title_catalogue.bin";
+    static constexpr const char* JSON_PATH = "romfs:/gfx/data/data.json";
+
+    // Get the catalogue, loading it on first use
+    static Ref Get();
+
+    // Console titles in data.json order
+    const std::vector<Entry>& GetEntries() const { return entries; }
+
+    // Find a title by id, returning nullptr if it isn't in the catalogue
+    const Entry* Find(u64 titleId) const;
+
+private:
+    std::vector<Entry> entries;
+
+    bool LoadBinary(const std::string& path);
+    bool LoadJson(const std::string& path);
+};
+
+}  // namespace pksm::titles
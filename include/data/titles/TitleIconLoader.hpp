@@ -0,0 +1,39 @@
+#pragma once
+
+#include <memory>
+#include <pu/Plutonium>
+#include <string>
+#include <vector>
+
+#include "utils/SpriteDecoder.hpp"
+
+namespace pksm::titles {
+
+// Loads title icons in the background. Titles with the same icon path share one texture, which is
+// freed once nothing on screen holds it anymore.
+class TitleIconLoader {
+public:
+    // Get the shared icon for a path. If it isn't loaded, an empty handle is returned and decoding
+    // starts in the background; the handle is filled in by ProcessDecodedIcons.
+    static pu::sdl2::TextureHandle::Ref GetIcon(const std::string& iconPath);
+
+    // Upload icons decoded in the background to their handles. Must be called once per frame on the
+    // render thread.
+    static void ProcessDecodedIcons();
+
+    // Stop the decoding thread
+    static void Cleanup();
+
+private:
+    struct Icon {
+        std::string path;
+        std::weak_ptr<pu::sdl2::TextureHandle> texture;
+    };
+
+    // Every icon path seen so far; the index is the id given to the decoder
+    static std::vector<Icon> icons;
+
+    static utils::SpriteDecoder decoder;
+};
+
+}  // namespace pksm::titles
@@ -1,5 +1,7 @@
 #pragma once
 #include <SDL2/SDL.h>
+#include <map>
+#include <memory>
 #include <pu/ui/elm/elm_Element.hpp>
 #include <pu/ui/render/render_Renderer.hpp>
 #include <pu/ui/ui_Types.hpp>
@@ -8,14 +10,16 @@ namespace pksm::ui::render {
 
 class PatternRenderer {
 public:
-    // Creates a texture with diagonal line pattern and rounded corners
-    static SDL_Texture* CreateDiagonalLinePattern(
+    // Returns a texture filled with backgroundColor and a diagonal line pattern, with the rounded corners left
+    // transparent. Textures are shared by everyone asking for the same parameters and freed with their last user.
+    static pu::sdl2::TextureHandle::Ref GetDiagonalLinePattern(
         const pu::i32 width,
         const pu::i32 height,
         const pu::i32 cornerRadius,
         const pu::i32 lineSpacing,
         const pu::i32 lineThickness,
-        const pu::ui::Color& lineColor
+        const pu::ui::Color& lineColor,
+        const pu::ui::Color& backgroundColor
     );
 
     // Helper to check if a point is within the rounded corner bounds
@@ -26,6 +30,30 @@ public:
         const pu::i32 cornerY,
         const pu::i32 radius
     );
+
+private:
+    // Side of the square tile the line pattern repeats with
+    static constexpr pu::i32 PATTERN_SIZE = 128;
+
+    struct PatternKey {
+        pu::i32 width;
+        pu::i32 height;
+        pu::i32 cornerRadius;
+        pu::i32 lineSpacing;
+        pu::i32 lineThickness;
+        u32 lineColor;
+        u32 backgroundColor;
+
+        bool operator<(const PatternKey& other) const;
+    };
+
+    static std::map<PatternKey, std::weak_ptr<pu::sdl2::TextureHandle>> patternCache;
+
+    // Pack a colour as a pixel of SDL_PIXELFORMAT_RGBA8888
+    static u32 PackPixel(const pu::ui::Color& color);
+
+    // Generates the pattern into a pixel buffer and uploads it in one go
+    static SDL_Texture* CreateDiagonalLinePattern(const PatternKey& key);
 };
 
 class PatternBackground : public pu::ui::elm::Element {
@@ -39,7 +67,7 @@ private:
     pu::i32 lineThickness;
     pu::ui::Color lineColor;
     pu::ui::Color backgroundColor;
-    SDL_Texture* backgroundTexture;
+    pu::sdl2::TextureHandle::Ref backgroundTexture;
 
     // Helper function for corner calculations
     static bool IsInRoundedCorner(
@@ -50,7 +78,7 @@ private:
         const pu::i32 radius
     );
 
-    // Create or recreate the background texture
+    // Fetch the background texture for the current parameters
     void CreateBackgroundTexture();
 
 public:
@@ -66,7 +94,6 @@ public:
         const pu::i32 lineThickness = 8
     );
     PU_SMART_CTOR(PatternBackground)
-    ~PatternBackground();
 
     // Element interface implementation
     pu::i32 GetX() override { return x; }
@@ -37,6 +37,7 @@ private:
     pu::ui::Color bgColor = pu::ui::Color(39, 66, 164, 255);
     std::function<void()> onBack;
     pksm::ui::TrainerInfo::Ref trainerInfo;
+    pu::ui::elm::CachedContainer::Ref trainerInfoCache;
     pksm::ui::MenuButtonGrid::Ref menuGrid;
     ISaveDataAccessor::Ref saveDataAccessor;
     std::map<pksm::ui::MenuButtonType, std::function<void()>> navigationCallbacks;
@@ -45,6 +46,7 @@ private:
     // Version display in top right
     pu::ui::elm::Image::Ref versionBackground;
     pu::ui::elm::TextBlock::Ref versionText;
+    pu::ui::elm::CachedContainer::Ref versionCache;
 
     // Layout constants
     static constexpr pu::i32 TRAINER_INFO_SIDE_MARGIN = 40;  // Margin from screen edges
@@ -39,6 +39,7 @@ private:
     
     // Settings items
     std::vector<pksm::ui::FocusableButton::Ref> settingButtons;
+    pksm::ui::FocusableButton::Ref backgroundAnimationButton;
     
     // Input handling
     pksm::input::ButtonInputHandler buttonHandler;
@@ -105,6 +105,9 @@ private:
     void FocusLoadButton();
     void FocusWirelessButton();
 
+    // Update the save list when saves of the selected title are found in the background
+    void OnSavesChanged(u64 titleId);
+
     // Override BaseLayout methods
     std::vector<pksm::ui::HelpItem> GetHelpOverlayItems() const override;
     void OnHelpOverlayShown() override;
@@ -34,6 +34,10 @@ public:
     // Set save data
     void SetDataSource(const std::vector<saves::Save::Ref>& saves);
 
+    // Replace the saves after more were found. If the new list only adds saves to the end they are
+    // appended, keeping the selection; otherwise this is the same as SetDataSource.
+    void UpdateDataSource(const std::vector<saves::Save::Ref>& saves);
+
     // Get currently selected save
     saves::Save::Ref GetSelectedSave() const;
 
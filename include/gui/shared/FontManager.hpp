@@ -14,7 +14,8 @@ public:
     // Function type for font name generators (e.g., MakeHeavyFontName)
     using FontNameGenerator = std::function<std::string(u32)>;
 
-    // Register a font with all custom sizes
+    // Register a font with all custom sizes. The file is read once and shared by every size, and each
+    // size only opens its face the first time text is drawn with it.
     static void RegisterFont(const std::string& fontPath, const FontNameGenerator& nameGenerator) {
         const std::vector<u32> sizes = {
             pksm::ui::global::FONT_SIZE_TITLE,
@@ -0,0 +1,19 @@
+#pragma once
+
+#include <string>
+
+namespace pksm::ui {
+
+// Interface settings kept between launches, stored as JSON on the SD card. Keys missing from the file keep their
+// defaults, so older files keep loading as settings are added.
+struct GuiSettings {
+    bool backgroundAnimationPaused = false;
+
+    static constexpr const char* DEFAULT_SETTINGS_PATH = "sdmc:/switch/PKSM/gui_settings.json";
+
+    // Returns the defaults when the file is missing or unreadable
+    static GuiSettings Load(const std::string& path = DEFAULT_SETTINGS_PATH);
+    bool Save(const std::string& path = DEFAULT_SETTINGS_PATH) const;
+};
+
+}  // namespace pksm::ui
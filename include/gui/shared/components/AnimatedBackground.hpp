@@ -39,6 +39,9 @@ private:
     std::optional<pu::ui::Color> tintColor;  // Optional tint color
     float customScaleFactor;  // Scale factor for the background
 
+    // Shared by every background, so the setting applies to all screens
+    static bool animationPaused;
+
     void InitializeBackground();
     void UpdateBackgroundAnimation();
     void ConfigureDefaultAnimations();  // New method to set up default animations
@@ -71,6 +74,10 @@ public:
     // Set a custom scale factor for the background
     void SetCustomScale(float scale);
 
+    // Freeze all animated backgrounds, which otherwise keep the app redrawing every frame
+    static void SetAnimationPaused(bool paused);
+    static bool IsAnimationPaused() { return animationPaused; }
+
     // Required Element overrides
     pu::i32 GetX() override { return 0; }  // Background is always at 0,0
     pu::i32 GetY() override { return 0; }
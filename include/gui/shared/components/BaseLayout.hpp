@@ -34,6 +34,7 @@ protected:
 
     // Help components
     pksm::ui::HelpFooter::Ref helpFooter;
+    pu::ui::elm::CachedContainer::Ref helpFooterCache;
 
     // Help methods
     void UpdateHelpItems(pksm::ui::IHelpProvider::Ref helpItemProvider);
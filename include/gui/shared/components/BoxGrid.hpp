@@ -36,12 +36,18 @@ private:
     // Components
     pu::ui::Container::Ref container;
     std::vector<BoxItem::Ref> items;
+
+    // Slots still waiting for their sprite to be decoded
+    std::vector<size_t> pendingSpriteSlots;
     pksm::input::DirectionalInputHandler inputHandler;
 
     // Event callbacks
     std::function<void(int)> onSelectionChangedCallback;
     std::function<void(int)> onPokemonMovedCallback;
 
+    // Show the slot's sprite if it is loaded, otherwise a placeholder until OnRender picks it up
+    void UpdateSlotSprite(size_t slotIndex);
+
     // IGrid layout method implementations
     pu::i32 GetItemWidth() const override { return itemSize; }
     pu::i32 GetItemHeight() const override { return itemSize; }
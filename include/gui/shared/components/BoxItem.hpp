@@ -4,6 +4,7 @@
 
 #include "gui/shared/components/PulsingOutline.hpp"
 #include "gui/shared/components/ShakeableWithOutline.hpp"
+#include "gui/shared/components/SpriteImage.hpp"
 #include "input/ButtonInputHandler.hpp"
 #include "input/TouchInputHandler.hpp"
 #include "input/visual-feedback/interfaces/IFocusable.hpp"
@@ -16,7 +17,9 @@ private:
     bool selected;
     pu::ui::Container::Ref container;
     pu::ui::elm::Rectangle::Ref background;
-    pu::ui::elm::Image::Ref image;
+    pksm::ui::SpriteImage::Ref image;
+    pu::ui::elm::Rectangle::Ref placeholder;  // Shown while the sprite is decoded in the background
+    bool spritePending;
     pksm::ui::RectangularOutline::Ref outline;
     pu::i32 outlinePadding;  // Padding between box and outline
     pu::i32 x;
@@ -27,6 +30,7 @@ private:
     pu::ui::Color selectedBgColor;
     static constexpr u32 OUTLINE_BORDER_WIDTH = 5;
     pu::ui::Color outlineColor = pu::ui::Color(70, 70, 70, 188);
+    pu::ui::Color placeholderColor = pu::ui::Color(255, 255, 255, 48);
 
     // Callbacks
     std::function<void()> onTouchSelectCallback;
@@ -36,13 +40,16 @@ private:
     pksm::input::TouchInputHandler touchHandler;
     pksm::input::ButtonInputHandler buttonHandler;
 
+    // Center the placeholder in the current item size
+    void UpdatePlaceholderLayout();
+
 public:
     BoxItem(
         const pu::i32 x,
         const pu::i32 y,
         const pu::i32 width,
         const pu::i32 height,
-        pu::sdl2::TextureHandle::Ref image,
+        const utils::PokemonSprite& sprite,
         const pu::i32 outlinePadding = 2,
         const pu::ui::Color defaultBgColor = pu::ui::Color(200, 200, 200, 58),
         const pu::ui::Color selectedBgColor = pu::ui::Color(255, 255, 0, 128)
@@ -60,8 +67,12 @@ public:
     pu::i32 GetWidth() override;
     pu::i32 GetHeight() override;
 
-    void SetImage(pu::sdl2::TextureHandle::Ref newImage);
-    pu::ui::elm::Image::Ref GetImage();
+    void SetSprite(const utils::PokemonSprite& sprite);
+
+    // Show a placeholder until the next SetSprite
+    void SetSpritePending();
+
+    pksm::ui::SpriteImage::Ref GetImage();
 
     // Controls whether this box is the currently selected one
     void SetSelected(bool select) override;
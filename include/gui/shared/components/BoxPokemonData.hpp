@@ -1,5 +1,6 @@
 #pragma once
 
+#include <optional>
 #include <pu/Plutonium>
 #include <string>
 #include <vector>
@@ -21,15 +22,31 @@ struct BoxPokemonData {
     // Helper to determine if this is an empty slot
     bool isEmpty() const { return species == 0; }
 
-    // Helper to get the texture handle for the sprite
-    pu::sdl2::TextureHandle::Ref getSprite() const {
+    // Helper to get the sprite, which may be a region of a shared atlas page
+    utils::PokemonSprite getSprite() const {
         if (isEmpty()) {
-            return nullptr;
+            return utils::PokemonSprite();
         }
 
         // Get the sprite from the sprite manager
         return utils::PokemonSpriteManager::GetPokemonSprite(species, form, shiny);
     }
+
+    // Non-blocking getSprite, returns std::nullopt while the sprite is decoded in the background
+    std::optional<utils::PokemonSprite> tryGetSprite() const {
+        if (isEmpty()) {
+            return utils::PokemonSprite();
+        }
+
+        return utils::PokemonSpriteManager::TryGetPokemonSprite(species, form, shiny);
+    }
+
+    // Start decoding the sprite in the background so it is ready when shown
+    void prefetchSprite() const {
+        if (!isEmpty()) {
+            utils::PokemonSpriteManager::PrefetchPokemonSprite(species, form, shiny);
+        }
+    }
 };
 
 // Structure to encapsulate box data
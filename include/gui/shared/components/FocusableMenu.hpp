@@ -45,6 +45,8 @@ public:
 
     // Data source management
     void SetDataSource(const std::vector<std::string>& items);
+    // Add items to the end, keeping the current selection and scroll position
+    void AppendDataSource(const std::vector<std::string>& items);
     const std::vector<std::string>& GetDataSource() const;
 
     // Touch selection callback
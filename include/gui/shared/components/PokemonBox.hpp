@@ -1,7 +1,6 @@
 #pragma once
 
 #include <pu/Plutonium>
-#include <set>
 
 #include "gui/shared/components/BoxGrid.hpp"
 #include "gui/shared/components/BoxNavigationButton.hpp"
@@ -82,10 +81,11 @@ private:
     void NextBox();
     void PreviousBox();
 
-    // Manage sprite cache when changing boxes
-    void UpdateSpriteCache();
     void UpdateBoxGrid();
 
+    // Decode the sprites of the boxes on either side in the background, so flipping boxes is instant
+    void PrefetchAdjacentBoxes();
+
     // Update box name display
     void UpdateBoxNameText();
 
@@ -28,7 +28,7 @@ public:
         const SDL_Rect& clipRect
     );
 
-    // Constructor for Pokemon sprite from individual files
+    // Constructor for Pokemon sprite from the sprite manager
     SpriteImage(
         const pu::i32 x,
         const pu::i32 y,
@@ -60,6 +60,9 @@ public:
     void SetClipRect(const SDL_Rect& clipRect);
     void SetImage(pu::sdl2::TextureHandle::Ref texture, const SDL_Rect* clipRect = nullptr);
 
+    // Set a sprite returned by the sprite manager
+    void SetSprite(const utils::PokemonSprite& sprite);
+
     // Set Pokemon sprite
     void SetPokemonSprite(u16 species, u8 form = 0, bool shiny = false);
 
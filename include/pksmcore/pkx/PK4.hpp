@@ -166,11 +166,13 @@ namespace pksm
         void hyperTrain(Stat, bool) override {}
 
         [[nodiscard]] std::string nickname(void) const override;
+        [[nodiscard]] std::string_view nicknameView(NameBuffer& buffer) const override;
         void nickname(const std::string_view& v) override;
         [[nodiscard]] GameVersion version(void) const override;
         void version(GameVersion v) override;
 
         [[nodiscard]] std::string otName(void) const override;
+        [[nodiscard]] std::string_view otNameView(NameBuffer& buffer) const override;
         void otName(const std::string_view& v) override;
         [[nodiscard]] u16 eggLocation(void) const override;
         void eggLocation(u16 v) override;
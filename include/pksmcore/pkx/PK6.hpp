@@ -137,6 +137,7 @@ namespace pksm
         void ribbonBattleCount(u8 v);
 
         [[nodiscard]] std::string nickname(void) const override;
+        [[nodiscard]] std::string_view nicknameView(NameBuffer& buffer) const override;
         void nickname(const std::string_view& v) override;
         [[nodiscard]] Move move(u8 move) const override;
         void move(u8 move, Move v) override;
@@ -194,6 +195,7 @@ namespace pksm
         void hyperTrain(Stat, bool) override {}
 
         [[nodiscard]] std::string otName(void) const override;
+        [[nodiscard]] std::string_view otNameView(NameBuffer& buffer) const override;
         void otName(const std::string_view& v) override;
         [[nodiscard]] u8 otFriendship(void) const override;
         void otFriendship(u8 v) override;
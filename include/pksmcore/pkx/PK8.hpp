@@ -143,6 +143,7 @@ namespace pksm
         void weight(u8 v);
 
         std::string nickname(void) const override;
+        std::string_view nicknameView(NameBuffer& buffer) const override;
         void nickname(const std::string_view& v) override;
         Move move(u8 move) const override;
         void move(u8 move, Move v) override;
@@ -214,6 +215,7 @@ namespace pksm
         void favRibbon(s8 v);
 
         std::string otName(void) const override;
+        std::string_view otNameView(NameBuffer& buffer) const override;
         void otName(const std::string_view& v) override;
         u8 otFriendship(void) const override;
         void otFriendship(u8 v) override;
@@ -46,9 +46,11 @@
 #include "utils/coretypes.h"
 #include "utils/DateTime.hpp"
 #include "utils/genToPkx.hpp"
+#include <array>
 #include <concepts>
 #include <memory>
 #include <string>
+#include <string_view>
 
 namespace pksm
 {
@@ -243,9 +245,15 @@ namespace pksm
         [[nodiscard]] virtual bool ribbon(Ribbon rib) const = 0;
         virtual void ribbon(Ribbon rib, bool v) = 0;
 
+        // Fixed-size storage for nicknameView and otNameView, large enough for any generation's names
+        using NameBuffer = std::array<char, 64>;
+
         // BLOCK B
         [[nodiscard]] virtual std::string nickname(void) const = 0;
         virtual void nickname(const std::string_view &v) = 0;
+        // Decodes the nickname into buffer and returns a view of it. Unlike nickname(), this does
+        // not allocate for Gen 4 and later, which makes it the better fit for listing a whole box.
+        [[nodiscard]] virtual std::string_view nicknameView(NameBuffer &buffer) const;
         [[nodiscard]] Move move(u8 move) const override = 0;
         void move(u8 move, Move v) override = 0;
         [[nodiscard]] Move relearnMove(u8 move) const override = 0;
@@ -276,6 +284,8 @@ namespace pksm
         // BLOCK D
         [[nodiscard]] virtual std::string otName(void) const = 0;
         virtual void otName(const std::string_view &v) = 0;
+        // See nicknameView
+        [[nodiscard]] virtual std::string_view otNameView(NameBuffer &buffer) const;
         [[nodiscard]] virtual u8 otFriendship(void) const = 0;
         virtual void otFriendship(u8 v) = 0;
         [[nodiscard]] virtual u8 htFriendship(void) const = 0;
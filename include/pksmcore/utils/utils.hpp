@@ -35,6 +35,7 @@
 #include <locale>
 #include <memory>
 #include <optional>
+#include <span>
 #include <stdarg.h>
 #include <string.h>
 #include <string>
@@ -117,6 +118,21 @@ namespace StringUtils
     void setString(u8* data, const std::string_view& v, int ofs, int len,
         char16_t terminator = u'\0', char16_t padding = u'\0');
 
+    // The Pokemon-specific codepoints to swap while decoding, as transString45/transString67 would
+    enum class CodepointSwap
+    {
+        None,
+        Gen45,
+        Gen67
+    };
+
+    // Allocation-free counterparts of getString and getString4. These decode into out, stopping at
+    // the last whole character that fits, and return the number of UTF-8 bytes written.
+    size_t getString(const u8* data, int ofs, int len, std::span<char> out,
+        char16_t term = u'\0', CodepointSwap swap = CodepointSwap::None);
+    size_t getString4(const u8* data, int ofs, int len, std::span<char> out,
+        CodepointSwap swap = CodepointSwap::None);
+
     [[nodiscard]] std::string getString4(const u8* data, int ofs, int len);
     void setString4(u8* data, const std::string_view& v, int ofs, int len);
     [[nodiscard]] std::string getString3(const u8* data, int ofs, int len, bool jp);
@@ -164,6 +180,13 @@ namespace StringUtils
 
     namespace internal
     {
+        // Transcodes src into out, which must have room for src.size() code units, and returns the
+        // number of code units written. ASCII runs are checked and widened 16 bytes at a time.
+        size_t transcodeUTF8toUTF16(const std::string_view& src, char16_t* out);
+        // Transcodes src into out, which must have room for src.size() * 3 bytes, and returns the
+        // number of bytes written. ASCII runs are checked and narrowed 16 bytes at a time.
+        size_t transcodeUTF16toUTF8(const std::u16string_view& src, char* out);
+
         template <typename RetType, typename First, typename... Params>
             requires (std::same_as<std::string, RetType> || std::same_as<std::u16string, RetType> ||
                          std::same_as<std::u32string, RetType>) &&
@@ -200,6 +223,22 @@ namespace StringUtils
                 std::u32string_view view{std::forward<decltype(f)>(f)};
                 ret.append(view.data(), view.size());
             }
+            else if constexpr (std::is_same_v<RetType, std::string> &&
+                               std::is_convertible_v<First, std::u16string_view>)
+            {
+                std::u16string_view view{std::forward<decltype(f)>(f)};
+                size_t oldSize = ret.size();
+                ret.resize(oldSize + view.size() * 3);
+                ret.resize(oldSize + transcodeUTF16toUTF8(view, ret.data() + oldSize));
+            }
+            else if constexpr (std::is_same_v<RetType, std::u16string> &&
+                               std::is_convertible_v<First, std::string_view>)
+            {
+                std::string_view view{std::forward<decltype(f)>(f)};
+                size_t oldSize = ret.size();
+                ret.resize(oldSize + view.size());
+                ret.resize(oldSize + transcodeUTF8toUTF16(view, ret.data() + oldSize));
+            }
             else
             {
                 auto view = toGenericView(std::forward<decltype(f)>(f));
@@ -252,6 +252,9 @@ extern DECLSPEC int SDLCALL TTF_WasInit(void);
 /* Get the kerning size of two glyphs */
 extern DECLSPEC int TTF_GetFontKerningSize(TTF_Font *font, int prev_index, int index);
 
+/* Get the kerning between two characters, 0 if the font doesn't provide both */
+int TTF_CppWrap_GetCharKerning(TTF_Font *font, Uint16 prev_ch, Uint16 ch);
+
 /* Code present in C++ code */
 TTF_Font *TTF_CppWrap_FindValidFont(TTF_Font *font, Uint16 ch);
 
@@ -28,6 +28,9 @@ namespace pu::sdl2 {
             inline Texture Get() {
                 return this->tex;
             }
+
+            // Swap in a new texture, deleting the old one. Everyone sharing the handle sees the change.
+            void Reset(Texture tex);
     };
 
 }
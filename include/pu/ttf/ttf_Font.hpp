@@ -2,10 +2,33 @@
 #pragma once
 #include <pu/sdl2/sdl2_Types.hpp>
 #include <pu/ui/ui_Types.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace pu::ttf {
 
+    // A glyph placed by Font::LayoutText, drawn from one of the font's glyph atlas pages
+    struct GlyphQuad {
+        u32 page;
+        SDL_Rect src;
+        SDL_Rect dst; // Relative to the top-left corner of the text
+    };
+
+    // Text laid out once and drawn every frame without rasterising anything
+    struct TextLayout {
+        std::vector<GlyphQuad> quads;
+        i32 width;
+        i32 height;
+
+        TextLayout() : quads(), width(0), height(0) {}
+    };
+
+    using FontFileBuffer = std::vector<u8>;
+
+    // Reads a font file once and shares the buffer between every face opened from it, at any size,
+    // for as long as one of them is alive
+    std::shared_ptr<const FontFileBuffer> LoadSharedFontFile(const std::string &path);
+
     class Font {
         private:
             using FontFaceDisposingFunction = void(*)(void*);
@@ -15,16 +38,30 @@ namespace pu::ttf {
                 void *ptr;
                 size_t ptr_sz;
                 FontFaceDisposingFunction dispose_fn;
-
-                FontFace(void *buf, const size_t buf_size, FontFaceDisposingFunction disp_fn, const u32 font_sz, void *font_class_ptr) : font(nullptr), ptr(buf), ptr_sz(buf_size), dispose_fn(disp_fn) {
-                    this->font = TTF_OpenFontRW(SDL_RWFromMem(this->ptr, this->ptr_sz), 1, font_sz);
-                    if(this->font != nullptr) {
-                        TTF_CppWrap_SetCppPtrRef(this->font, font_class_ptr);
+                std::shared_ptr<const FontFileBuffer> file_buf; // Keeps a shared file buffer alive, ptr points into it
+                u32 font_sz;
+                void *font_class_ptr;
+                bool open_failed;
+
+                FontFace(void *buf, const size_t buf_size, FontFaceDisposingFunction disp_fn, const u32 font_sz, void *font_class_ptr) : font(nullptr), ptr(buf), ptr_sz(buf_size), dispose_fn(disp_fn), file_buf(), font_sz(font_sz), font_class_ptr(font_class_ptr), open_failed(false) {}
+
+                FontFace() : font(nullptr), ptr(nullptr), ptr_sz(0), dispose_fn(EmptyFontFaceDisposingFunction), file_buf(), font_sz(0), font_class_ptr(nullptr), open_failed(false) {}
+
+                // The FreeType face is only opened the first time it is used, so sizes or fallback faces
+                // that never draw anything cost neither parsing time nor glyph memory
+                sdl2::Font Get() {
+                    if((this->font == nullptr) && !this->open_failed && this->IsSourceValid()) {
+                        this->font = TTF_OpenFontRW(SDL_RWFromConstMem(this->ptr, this->ptr_sz), 1, this->font_sz);
+                        if(this->font != nullptr) {
+                            TTF_CppWrap_SetCppPtrRef(this->font, this->font_class_ptr);
+                        }
+                        else {
+                            this->open_failed = true;
+                        }
                     }
+                    return this->font;
                 }
 
-                FontFace() : font(nullptr), ptr(nullptr), ptr_sz(0), dispose_fn(EmptyFontFaceDisposingFunction) {}
-
                 inline bool IsSourceValid() {
                     // AKA - is the base ptr and size valid?
                     return (this->ptr != nullptr) && (this->ptr_sz > 0);
@@ -44,23 +81,55 @@ namespace pu::ttf {
                         this->ptr = nullptr;
                         this->ptr_sz = 0;
                     }
+                    this->file_buf.reset();
                 }
 
             };
 
+            // A glyph rasterised in white into an atlas page, tinted when drawn
+            struct Glyph {
+                sdl2::Font face;
+                u32 page;
+                SDL_Rect src;
+                i32 offset_x; // From the pen position to the left of src
+                i32 offset_y; // From the top of the line to the top of src
+                i32 advance;
+            };
+
+            // Atlas pages are filled shelf by shelf, left to right. A page starts small and doubles in
+            // size until it reaches GlyphPageMaxSize; only then is another page started.
+            struct GlyphPage {
+                sdl2::Texture tex;
+                i32 size;
+                i32 shelf_x;
+                i32 shelf_y;
+                i32 shelf_h;
+            };
+
             std::vector<std::pair<i32, std::unique_ptr<FontFace>>> font_faces;
             u32 font_size;
+            std::unordered_map<Uint16, Glyph> glyphs;
+            std::vector<GlyphPage> glyph_pages;
 
             inline sdl2::Font TryGetFirstFont() {
                 if(!this->font_faces.empty()) {
-                    return this->font_faces.begin()->second->font;
+                    return this->font_faces.begin()->second->Get();
                 }
                 return nullptr;
             }
 
+            const Glyph *FindGlyph(const Uint16 ch);
+            bool AllocateGlyphRect(const i32 w, const i32 h, u32 &out_page, SDL_Rect &out_rect);
+            bool GrowGlyphPage(GlyphPage &page);
+
         public:
             static constexpr i32 InvalidFontFaceIndex = -1;
             static constexpr u32 DefaultFontSize = 25;
+            // 256 KB of texture memory at first, at most 4 MB per page
+            static constexpr i32 GlyphPageInitialSize = 256;
+            static constexpr i32 GlyphPageMaxSize = 1024;
+            // Same spacing as TTF_RenderUTF8_Blended_Wrapped puts between lines
+            static constexpr i32 LineSpacing = 2;
 
             static void EmptyFontFaceDisposingFunction(void*) {}
 
@@ -82,6 +151,17 @@ namespace pu::ttf {
             sdl2::Font FindValidFontFor(const Uint16 ch);
             std::pair<u32, u32> GetTextDimensions(const std::string &str);
             sdl2::Texture RenderText(const std::string &str, const ui::Color clr);
+
+            // Lays out text with glyphs from the atlas, rasterising only glyphs never seen before.
+            // Lines are wrapped at spaces to wrap_width, or to the window width like RenderText if 0.
+            TextLayout LayoutText(const std::string &str, const u32 wrap_width = 0);
+
+            inline sdl2::Texture GetGlyphPageTexture(const u32 page) {
+                if(page < this->glyph_pages.size()) {
+                    return this->glyph_pages.at(page).tex;
+                }
+                return nullptr;
+            }
     };
 
 }
@@ -0,0 +1,102 @@
+#pragma once
+
+#include <pu/ui/elm/elm_Element.hpp>
+#include <vector>
+
+namespace pu::ui::elm {
+
+    // Draws its elements once into a texture and then draws that texture until they change.
+    // Elements are positioned in screen coordinates as usual, and anything drawn outside the container's area is cut off.
+    // They are drawn again when one of them is dirty, moves, resizes or changes visibility, or after Invalidate.
+    // Elements must draw through the Renderer, since drawing straight to the SDL renderer isn't shifted into the cache.
+    // Animated elements gain nothing from caching and should stay outside.
+    class CachedContainer : public Element {
+        private:
+            struct ElementState {
+                i32 x;
+                i32 y;
+                i32 w;
+                i32 h;
+                bool visible;
+
+                inline bool operator==(const ElementState &other) const {
+                    return (this->x == other.x) && (this->y == other.y) && (this->w == other.w) && (this->h == other.h) && (this->visible == other.visible);
+                }
+            };
+
+            i32 x;
+            i32 y;
+            i32 w;
+            i32 h;
+            std::vector<Element::Ref> elems;
+            std::vector<ElementState> elem_states;
+            sdl2::Texture cache_tex;
+            bool cache_valid;
+
+            static ElementState GetElementState(Element::Ref &elem);
+            bool CacheOutdated();
+            bool RedrawCache(render::Renderer::Ref &drawer, const i32 x, const i32 y);
+            void RenderElements(render::Renderer::Ref &drawer);
+
+        public:
+            CachedContainer(const i32 x, const i32 y, const i32 width, const i32 height) : Element(), x(x), y(y), w(width), h(height), elems(), elem_states(), cache_tex(nullptr), cache_valid(false) {}
+            PU_SMART_CTOR(CachedContainer)
+            ~CachedContainer();
+
+            inline i32 GetX() override {
+                return this->x;
+            }
+
+            inline void SetX(const i32 x) {
+                this->x = x;
+                this->Invalidate();
+            }
+
+            inline i32 GetY() override {
+                return this->y;
+            }
+
+            inline void SetY(const i32 y) {
+                this->y = y;
+                this->Invalidate();
+            }
+
+            inline i32 GetWidth() override {
+                return this->w;
+            }
+
+            void SetWidth(const i32 width);
+
+            inline i32 GetHeight() override {
+                return this->h;
+            }
+
+            void SetHeight(const i32 height);
+
+            inline void Add(Element::Ref elem) {
+                this->elems.push_back(elem);
+                this->Invalidate();
+            }
+
+            inline std::vector<Element::Ref> &GetElements() {
+                return this->elems;
+            }
+
+            inline void Clear() {
+                this->elems.clear();
+                this->Invalidate();
+            }
+
+            // For changes the elements can't report themselves
+            inline void Invalidate() {
+                this->cache_valid = false;
+                this->MarkDirty();
+            }
+
+            bool IsDirty() override;
+
+            void OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) override;
+            void OnInput(const u64 keys_down, const u64 keys_up, const u64 keys_held, const TouchPoint touch_pos) override;
+    };
+
+}
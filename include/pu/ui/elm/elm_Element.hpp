@@ -40,9 +40,10 @@ namespace pu::ui::elm {
             HorizontalAlign h_align;
             VerticalAlign v_align;
             Container *parent_container;
+            bool dirty;
 
         public:
-            Element() : visible(true), h_align(HorizontalAlign::Left), v_align(VerticalAlign::Up), parent_container(nullptr) {}
+            Element() : visible(true), h_align(HorizontalAlign::Left), v_align(VerticalAlign::Up), parent_container(nullptr), dirty(true) {}
             PU_SMART_CTOR(Element)
             virtual ~Element() {}
 
@@ -58,7 +59,25 @@ namespace pu::ui::elm {
             }
 
             inline void SetVisible(const bool visible) {
-                this->visible = visible;
+                if(this->visible != visible) {
+                    this->visible = visible;
+                    this->MarkDirty();
+                }
+            }
+
+            // Called when what the element draws changes, so that a CachedContainer holding it draws it again
+            inline void MarkDirty() {
+                this->dirty = true;
+                RequestRedraw();
+            }
+
+            // Elements made of other elements can override this to report changes in their children
+            virtual bool IsDirty() {
+                return this->dirty;
+            }
+
+            virtual void ClearDirty() {
+                this->dirty = false;
             }
 
             inline void SetHorizontalAlign(const HorizontalAlign align) {
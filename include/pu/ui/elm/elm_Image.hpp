@@ -20,6 +20,7 @@ namespace pu::ui::elm {
         private:
             std::string img_path;
             sdl2::TextureHandle::Ref img_tex;
+            sdl2::Texture rendered_tex;
             render::TextureRenderOptions rend_opts;
             i32 x;
             i32 y;
@@ -68,6 +69,9 @@ namespace pu::ui::elm {
                 return this->img_tex != nullptr;
             }
             
+            // Handles can be filled in after SetImage (e.g. when decoded in the background)
+            bool IsDirty() override;
+
             void OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) override;
             void OnInput(const u64 keys_down, const u64 keys_up, const u64 keys_held, const TouchPoint touch_pos) override {}
     };
@@ -62,7 +62,12 @@ namespace pu::ui::elm {
             }
 
             PU_CLASS_POD_GETSET(BorderRadius, border_radius, i32)
-            PU_CLASS_POD_GETSET(Color, clr, Color)
+            PU_CLASS_POD_GET(Color, clr, Color)
+
+            inline void SetColor(const Color clr) {
+                this->clr = clr;
+                this->MarkDirty();
+            }
             
             void OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) override;
             void OnInput(const u64 keys_down, const u64 keys_up, const u64 keys_held, const TouchPoint touch_pos) override {}
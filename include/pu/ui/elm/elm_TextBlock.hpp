@@ -25,13 +25,16 @@ namespace pu::ui::elm {
             i32 y;
             Color clr;
             std::string text;
-            sdl2::Texture text_tex;
             std::string fnt_name;
+            // Laid out from the font's glyph atlas, so changing the colour never re-renders anything
+            std::shared_ptr<ttf::Font> fnt;
+            ttf::TextLayout layout;
+
+            void UpdateLayout();
         
         public:
             TextBlock(const i32 x, const i32 y, const std::string &text);
             PU_SMART_CTOR(TextBlock)
-            ~TextBlock();
 
             inline i32 GetX() override {
                 return this->x;
@@ -61,7 +64,11 @@ namespace pu::ui::elm {
 
             PU_CLASS_POD_GET(Color, clr, Color)
             
-            void SetColor(const Color clr);
+            inline void SetColor(const Color clr) {
+                this->clr = clr;
+                this->MarkDirty();
+            }
+
             void OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) override;
             void OnInput(const u64 keys_down, const u64 keys_up, const u64 keys_held, const TouchPoint touch_pos) override {}
     };
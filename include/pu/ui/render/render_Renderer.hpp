@@ -14,6 +14,7 @@
 #include <pu/ttf/ttf_Font.hpp>
 #include <pu/ui/render/render_SDL2.hpp>
 #include <pu/ui/ui_Types.hpp>
+#include <unordered_map>
 #include <vector>
 
 namespace pu::ui::render {
@@ -139,6 +140,72 @@ private:
     i32 base_y;
     i32 base_a;
     PadState input_pad;
+    u32 frame_draw_calls;
+    u32 last_frame_draw_calls;
+    u64 total_draw_calls;
+    bool shape_batching;
+
+    // What EndLayer restores, one entry per BeginLayer
+    struct LayerState {
+        sdl2::Texture prev_target;
+        i32 base_x;
+        i32 base_y;
+        i32 base_a;
+    };
+    std::vector<LayerState> layer_stack;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // Reused between text draws so batching glyphs doesn't allocate every frame
+    std::vector<SDL_Vertex> text_vertices;
+    std::vector<int> text_indices;
+
+    void FlushTextBatch(sdl2::Texture page_tex);
+
+    // Rounded rectangles tessellated relative to their top left corner, reused for every shape of the same size
+    struct ShapeKey {
+        i32 width;
+        i32 height;
+        i32 radius;
+        i32 border_width;  // 0 for a filled shape
+
+        inline bool operator==(const ShapeKey& other) const {
+            return (this->width == other.width) && (this->height == other.height) && (this->radius == other.radius) &&
+                (this->border_width == other.border_width);
+        }
+    };
+
+    struct ShapeKeyHash {
+        size_t operator()(const ShapeKey& key) const;
+    };
+
+    struct ShapeGeometry {
+        std::vector<SDL_FPoint> points;
+        std::vector<int> indices;
+    };
+
+    std::unordered_map<ShapeKey, ShapeGeometry, ShapeKeyHash> shape_cache;
+
+    // Untextured shapes waiting to be submitted together
+    std::vector<SDL_Vertex> shape_vertices;
+    std::vector<int> shape_indices;
+
+    const ShapeGeometry& GetShapeGeometry(const ShapeKey& key);
+    void BatchShape(const ShapeGeometry& geometry, const Color clr, const i32 x, const i32 y);
+    void BatchRectangle(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height);
+#endif
+
+    inline void CountDrawCalls(const u32 count) {
+        this->frame_draw_calls += count;
+        this->total_draw_calls += count;
+    }
+
+    void RenderTextureRegion(
+        sdl2::Texture texture,
+        const SDL_Rect* src_rect,
+        const i32 x,
+        const i32 y,
+        const TextureRenderOptions opts
+    );
 
     inline u8 GetActualAlpha(const u8 input_a) {
         if (this->base_a >= 0) {
@@ -157,7 +224,11 @@ public:
         base_x(0),
         base_y(0),
         base_a(0),
-        input_pad() {}
+        input_pad(),
+        frame_draw_calls(0),
+        last_frame_draw_calls(0),
+        total_draw_calls(0),
+        shape_batching(true) {}
     PU_SMART_CTOR(Renderer)
 
     void Initialize();
@@ -175,6 +246,16 @@ public:
         const i32 y,
         const TextureRenderOptions opts = TextureRenderOptions::Default()
     );
+
+    // Draws only src_rect of the texture, e.g. one sprite of an atlas page. Without custom dimensions
+    // the region is drawn at its own size.
+    void RenderTexture(
+        sdl2::Texture texture,
+        const SDL_Rect& src_rect,
+        const i32 x,
+        const i32 y,
+        const TextureRenderOptions opts = TextureRenderOptions::Default()
+    );
     void RenderRectangle(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height);
     void RenderRectangleFill(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height);
 
@@ -211,6 +292,17 @@ public:
         const i32 height,
         const i32 radius
     );
+
+    // Same as drawing border_width rounded rectangles inside each other, each one pixel smaller in every direction
+    void RenderRoundedRectangleBorder(
+        const Color clr,
+        const i32 x,
+        const i32 y,
+        const i32 width,
+        const i32 height,
+        const i32 radius,
+        const i32 border_width
+    );
     void RenderCircle(const Color clr, const i32 x, const i32 y, const i32 radius);
     void RenderCircleFill(const Color clr, const i32 x, const i32 y, const i32 radius);
     void RenderEllipse(const Color clr, const i32 x, const i32 y, const i32 rx, const i32 ry);
@@ -224,6 +316,35 @@ public:
         const u8 main_alpha = 0xFF
     );
 
+    // Draws text laid out by ttf::Font::LayoutText, batching all glyphs from the same atlas page
+    void RenderTextLayout(ttf::Font& font, const ttf::TextLayout& layout, const Color clr, const i32 x, const i32 y);
+
+    // Redirects drawing into a SDL_TEXTUREACCESS_TARGET texture until EndLayer, cleared to transparent first. Everything
+    // drawn through the renderer is shifted so that (x, y) lands on the texture's top left corner, and the base alpha
+    // is suspended so that fading applies when the layer is drawn rather than inside it. Layers can be nested.
+    bool BeginLayer(sdl2::Texture target, const i32 x, const i32 y);
+    void EndLayer();
+
+    // Draws a texture filled between BeginLayer and EndLayer. Blending into a transparent target leaves its colours
+    // premultiplied by alpha, so it is composited with a premultiplied blend mode instead of the usual one.
+    void RenderLayer(sdl2::Texture layer, const i32 x, const i32 y);
+
+    // Rectangles and rounded rectangles are queued and submitted together with SDL_RenderGeometry on SDL 2.0.18 and
+    // later. Any other drawing through the renderer submits them first to keep the draw order, and so does
+    // GetMainRenderer, for code that draws straight to SDL.
+    void FlushShapes();
+
+    // Batching is on by default. Turning it off draws every shape on its own again, through SDL and SDL2_gfx, which is
+    // only useful to compare the two. Has no effect before SDL 2.0.18.
+    void SetShapeBatching(const bool shape_batching);
+
+    inline bool IsShapeBatching() { return this->shape_batching; }
+
+    // Draw calls issued through the renderer. SDL2_gfx shapes count once, although they break down into several SDL calls.
+    inline u32 GetLastFrameDrawCallCount() { return this->last_frame_draw_calls; }
+
+    inline u64 GetTotalDrawCallCount() { return this->total_draw_calls; }
+
     inline void SetBaseRenderPosition(const i32 x, const i32 y) {
         this->base_x = x;
         this->base_y = y;
@@ -255,6 +376,7 @@ std::pair<u32, u32> GetDimensions();
 // Font loading
 
 bool AddFont(const std::string& font_name, std::shared_ptr<ttf::Font>& font);
+std::shared_ptr<ttf::Font> GetFont(const std::string& font_name);
 
 bool LoadSingleSharedFontInFont(std::shared_ptr<ttf::Font>& font, const PlSharedFontType type);
 bool LoadAllSharedFontsInFont(std::shared_ptr<ttf::Font>& font);
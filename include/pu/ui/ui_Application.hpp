@@ -28,6 +28,11 @@ namespace pu::ui {
             using RenderTopCallback = std::function<void(render::Renderer::Ref&)>;
 
             static constexpr u8 DefaultFadeAlphaIncrementSteps = 20;
+            // Skipped frames sleep this long instead of waiting for vsync in SDL_RenderPresent
+            static constexpr u64 IdleFrameTimeNs = 16'666'667;
+            // Input usually starts animations in app elements that don't request redraws themselves,
+            // so frames keep being drawn for a while after the last input
+            static constexpr u64 InputRedrawDurationMs = 1000;
 
         protected:
             bool loaded;
@@ -48,6 +53,13 @@ namespace pu::ui {
             OnInputCallback on_ipt_cb;
             render::Renderer::Ref renderer;
             RMutex render_lock;
+            bool skip_idle_frames;
+            std::chrono::steady_clock::time_point last_input_time;
+            u64 rendered_frame_count;
+            u64 skipped_frame_count;
+
+            bool NeedsRender();
+            void OnIdle();
         
         public:
             Application(render::Renderer::Ref renderer);
@@ -56,6 +68,7 @@ namespace pu::ui {
 
             inline void LoadLayout(Layout::Ref lyt) {
                 this->lyt = lyt;
+                RequestRedraw();
             }
 
             template<typename L>
@@ -147,6 +160,20 @@ namespace pu::ui {
             
             void OnRender();
             void Close(const bool do_exit = false);
+
+            // When enabled, frames where nothing changed are not drawn or presented
+            inline void SetSkipIdleFrames(const bool skip_idle_frames) {
+                this->skip_idle_frames = skip_idle_frames;
+                RequestRedraw();
+            }
+
+            inline u64 GetRenderedFrameCount() {
+                return this->rendered_frame_count;
+            }
+
+            inline u64 GetSkippedFrameCount() {
+                return this->skipped_frame_count;
+            }
             
             inline void CloseWithFadeOut(const bool do_exit = false) {
                 this->FadeOut();
@@ -78,6 +78,10 @@ namespace pu::ui {
             }
             
             TouchPoint ConsumeSimulatedTouchPosition();
+
+            inline bool HasSimulatedTouchPosition() {
+                return !this->sim_touch_pos.IsEmpty();
+            }
     };
 
 }
@@ -166,4 +166,13 @@ namespace pu::ui {
             }
     };
 
+
+    // The application only composes a new frame when something changed. Elements call this when their
+    // appearance changes outside of input handling, and animated elements call it every frame they
+    // animate. Safe to call from any thread.
+    void RequestRedraw();
+
+    // Returns whether a redraw was requested since the last call, clearing the request
+    bool ConsumeRedrawRequest();
+
 }
@@ -0,0 +1,45 @@
+#pragma once
+
+#include <chrono>
+#include <cstddef>
+#include <switch.h>
+
+namespace pksm::utils {
+
+// Measures the time between frames and logs frames that miss vsync, plus a periodic summary. Also logs
+// how many frames were actually drawn each minute and how many were skipped as idle because nothing
+// changed, and how many draw calls the drawn frames took on average.
+class FrameTimeMonitor {
+public:
+    // Call once per main loop iteration from the render thread, with the application's counts of drawn and
+    // skipped frames and the renderer's count of draw calls
+    void Tick(u64 renderedFrameCount, u64 skippedFrameCount, u64 drawCallCount);
+
+    // 60 FPS
+    static constexpr std::chrono::microseconds FRAME_BUDGET{16667};
+
+    // A frame this long has certainly missed a vsync rather than just jittered around one
+    static constexpr std::chrono::microseconds SLOW_FRAME_THRESHOLD{FRAME_BUDGET * 5 / 4};
+
+    // Frames per logged summary, about five seconds at 60 FPS
+    static constexpr size_t SUMMARY_INTERVAL = 300;
+
+    static constexpr std::chrono::seconds RENDERED_FRAMES_INTERVAL{60};
+
+private:
+    std::chrono::steady_clock::time_point lastFrame;
+    bool hasLastFrame = false;
+
+    // Stats for the current summary interval
+    size_t frameCount = 0;
+    size_t slowFrameCount = 0;
+    std::chrono::microseconds totalTime{0};
+    std::chrono::microseconds worstTime{0};
+
+    std::chrono::steady_clock::time_point renderedFramesStart;
+    u64 renderedFramesAtStart = 0;
+    u64 skippedFramesAtStart = 0;
+    u64 drawCallsAtStart = 0;
+};
+
+}  // namespace pksm::utils
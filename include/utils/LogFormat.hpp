@@ -0,0 +1,52 @@
+#pragma once
+
+#include <cstddef>
+#include <initializer_list>
+#include <string>
+#include <string_view>
+#include <type_traits>
+
+namespace pksm::utils {
+
+// One argument of a log message, captured without copying or converting it
+class LogArg {
+public:
+    enum class Kind { Signed, Unsigned, Float, Bool, String, Pointer };
+
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && std::is_signed_v<T>)
+    LogArg(T value) : kind(Kind::Signed), signedValue(value) {}
+
+    template <typename T>
+        requires(std::is_integral_v<T> && !std::is_same_v<T, bool> && std::is_unsigned_v<T>)
+    LogArg(T value) : kind(Kind::Unsigned), unsignedValue(value) {}
+
+    template <typename T>
+        requires std::is_enum_v<T>
+    LogArg(T value) : LogArg(static_cast<std::underlying_type_t<T>>(value)) {}
+
+    LogArg(double value) : kind(Kind::Float), floatValue(value) {}
+    LogArg(bool value) : kind(Kind::Bool), boolValue(value) {}
+    LogArg(const char* value) : kind(Kind::String), stringValue(value ? value : "(null)") {}
+    LogArg(const std::string& value) : kind(Kind::String), stringValue(value) {}
+    LogArg(std::string_view value) : kind(Kind::String), stringValue(value) {}
+    LogArg(const void* value) : kind(Kind::Pointer), pointerValue(value) {}
+
+    Kind kind;
+    union {
+        long long signedValue;
+        unsigned long long unsignedValue;
+        double floatValue;
+        bool boolValue;
+        std::string_view stringValue;
+        const void* pointerValue;
+    };
+};
+
+// Format a log message into out, which holds capacity characters, and return the length of the
+// whole message; anything past capacity is cut off. Each {} in the format is replaced by the next
+// argument. {:x} writes integers in hex and a width can be given, as in {:8} or {:016x}.
+// {{ and }} are literal braces.
+size_t FormatLogMessage(char* out, size_t capacity, std::string_view format, std::initializer_list<LogArg> args);
+
+}  // namespace pksm::utils
@@ -0,0 +1,73 @@
+#pragma once
+
+#include <atomic>
+#include <cstddef>
+#include <memory>
+#include <switch/types.h>
+
+namespace pksm::utils {
+
+// Fixed-size queue of log records that any number of threads can push to without locking, drained
+// by a single consumer. Pushing never blocks or allocates: when the queue is full the record is
+// dropped and counted instead.
+class LogRing {
+public:
+    // Longer messages are cut off. Together with the header this makes each slot 512 bytes.
+    static constexpr size_t TEXT_SIZE = 488;
+
+    struct Record {
+        u64 tick;  // Monotonic time in nanoseconds
+        u8 level;
+        bool truncated;
+        u16 length;
+        char text[TEXT_SIZE];
+    };
+
+    // capacity is rounded up to a power of two
+    explicit LogRing(size_t capacity);
+
+    LogRing(const LogRing&) = delete;
+    LogRing& operator=(const LogRing&) = delete;
+
+    // Copy a record into the queue, returning false if it was full. Only the first TEXT_SIZE
+    // characters of longer texts are read, and the record is marked as truncated.
+    bool TryPush(u64 tick, u8 level, const char* text, size_t length);
+
+    // Hand up to maxRecords queued records to consume, oldest first, returning how many there were.
+    // Only one thread may drain.
+    template <typename Consumer>
+    size_t Drain(Consumer&& consume, size_t maxRecords) {
+        size_t count = 0;
+        while (count < maxRecords) {
+            Slot& slot = slots[dequeuePos & mask];
+            if (slot.sequence.load(std::memory_order_acquire) != dequeuePos + 1) {
+                break;
+            }
+
+            consume(static_cast<const Record&>(slot.record));
+            slot.sequence.store(dequeuePos + mask + 1, std::memory_order_release);
+            dequeuePos++;
+            count++;
+        }
+        return count;
+    }
+
+    // Number of records dropped since the last call
+    u64 TakeDropped() { return dropped.exchange(0, std::memory_order_relaxed); }
+
+private:
+    // A slot is free for the push at position p when its sequence is p, and holds that push's
+    // record once the sequence is p + 1
+    struct Slot {
+        std::atomic<size_t> sequence;
+        Record record;
+    };
+
+    std::unique_ptr<Slot[]> slots;
+    size_t mask;
+    alignas(64) std::atomic<size_t> enqueuePos{0};
+    alignas(64) size_t dequeuePos = 0;
+    std::atomic<u64> dropped{0};
+};
+
+}  // namespace pksm::utils
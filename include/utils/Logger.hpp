@@ -1,24 +1,66 @@
 #pragma once
 
+#include <atomic>
+#include <cstdio>
 #include <string>
+#include <string_view>
 #include <switch.h>
 
+#include "utils/LogFormat.hpp"
+
 namespace pksm::utils {
 
 class Logger {
 public:
     enum class Level { Debug, Info, Warning, Error };
 
+    // Messages are cut off at this length
+    static constexpr size_t MAX_MESSAGE_SIZE = 488;
+
 #ifdef NDEBUG
     static inline void Initialize() {}
+    static inline void Initialize(std::FILE*) {}
     static inline void Finalize() {}
+    static constexpr bool IsEnabled(Level) { return false; }
+    static inline void SetLevel(Level) {}
     static inline void Debug(const std::string&) {}
     static inline void Info(const std::string&) {}
     static inline void Warning(const std::string&) {}
     static inline void Error(const std::string&) {}
+    template <typename... Args>
+    static inline void Format(Level, std::string_view, const Args&...) {}
 #else
+    // Log over nxlink if it is connected
     static void Initialize();
+
+    // Log to an open stream such as stdout or a file instead, e.g. when running off console
+    static void Initialize(std::FILE* sink);
+
+    // Write out everything still queued and stop logging
     static void Finalize();
+
+    // Whether messages of a level are written. False until the logger is initialized, and for
+    // levels below the one set with SetLevel. The LOG_ macros check this before building messages.
+    // Acquires the queue StartWriter published, so a thread that sees logging enabled can push to it.
+    static bool IsEnabled(Level level) {
+        return static_cast<int>(level) >= threshold.load(std::memory_order_acquire);
+    }
+
+    // Skip messages below level from now on. Everything is logged by default.
+    static void SetLevel(Level level);
+
+    // Format a message into a stack buffer and log it, see FormatLogMessage for the syntax.
+    // Nothing is formatted if the level is disabled.
+    template <typename... Args>
+    static void Format(Level level, std::string_view format, const Args&... args) {
+        if (!IsEnabled(level)) {
+            return;
+        }
+        char message[MAX_MESSAGE_SIZE];
+        const size_t length = FormatLogMessage(message, sizeof(message), format, {LogArg(args)...});
+        Log(level, message, length);
+    }
+
     static void Debug(const std::string& message);
     static void Info(const std::string& message);
     static void Warning(const std::string& message);
@@ -26,8 +68,20 @@ public:
     static void LogMemoryInfo();
 
 private:
-    static void Log(Level level, const std::string& message);
-    static bool initialized;
+    // Queue a message for the writer thread. Never blocks; if the queue is full the message is
+    // dropped and the writer reports how many were lost.
+    // length may be larger than what text holds, in which case the message is marked as cut off
+    static void Log(Level level, const char* text, size_t length);
+
+    static void StartWriter(std::FILE* sink);
+    static void WriterLoop(std::FILE* sink);
+
+    // Lowest level that is written; DISABLED while the logger isn't running
+    static constexpr int DISABLED = static_cast<int>(Level::Error) + 1;
+    static std::atomic<int> threshold;
+    static Level minimumLevel;
+
+    static std::atomic<bool> initialized;
     static bool socket_initialized;
     static bool console_initialized;
 #endif
@@ -40,11 +94,27 @@ private:
 #define LOG_INFO(msg) ((void)0)
 #define LOG_WARNING(msg) ((void)0)
 #define LOG_ERROR(msg) ((void)0)
+#define LOG_DEBUGF(...) ((void)0)
+#define LOG_INFOF(...) ((void)0)
+#define LOG_WARNINGF(...) ((void)0)
+#define LOG_ERRORF(...) ((void)0)
 #define LOG_MEMORY() ((void)0)
 #else
-#define LOG_DEBUG(msg) pksm::utils::Logger::Debug(msg)
-#define LOG_INFO(msg) pksm::utils::Logger::Info(msg)
-#define LOG_WARNING(msg) pksm::utils::Logger::Warning(msg)
-#define LOG_ERROR(msg) pksm::utils::Logger::Error(msg)
-#define LOG_MEMORY() pksm::utils::Logger::LogMemoryInfo()
+// The message expression is only evaluated if the level is enabled
+#define PKSM_LOG_IF_ENABLED(level, ...) \
+    (pksm::utils::Logger::IsEnabled(pksm::utils::Logger::Level::level) ? (__VA_ARGS__) : (void)0)
+#define LOG_DEBUG(msg) PKSM_LOG_IF_ENABLED(Debug, pksm::utils::Logger::Debug(msg))
+#define LOG_INFO(msg) PKSM_LOG_IF_ENABLED(Info, pksm::utils::Logger::Info(msg))
+#define LOG_WARNING(msg) PKSM_LOG_IF_ENABLED(Warning, pksm::utils::Logger::Warning(msg))
+#define LOG_ERROR(msg) PKSM_LOG_IF_ENABLED(Error, pksm::utils::Logger::Error(msg))
+// Deferred formatting: LOG_DEBUGF("Loaded {} titles in {}ms", count, ms)
+#define LOG_DEBUGF(...) \
+    PKSM_LOG_IF_ENABLED(Debug, pksm::utils::Logger::Format(pksm::utils::Logger::Level::Debug, __VA_ARGS__))
+#define LOG_INFOF(...) \
+    PKSM_LOG_IF_ENABLED(Info, pksm::utils::Logger::Format(pksm::utils::Logger::Level::Info, __VA_ARGS__))
+#define LOG_WARNINGF(...) \
+    PKSM_LOG_IF_ENABLED(Warning, pksm::utils::Logger::Format(pksm::utils::Logger::Level::Warning, __VA_ARGS__))
+#define LOG_ERRORF(...) \
+    PKSM_LOG_IF_ENABLED(Error, pksm::utils::Logger::Format(pksm::utils::Logger::Level::Error, __VA_ARGS__))
+#define LOG_MEMORY() PKSM_LOG_IF_ENABLED(Debug, pksm::utils::Logger::LogMemoryInfo())
 #endif
\ No newline at end of file
@@ -2,21 +2,51 @@
 
 #include <SDL2/SDL.h>
 #include <SDLHelper.hpp>
-#include <map>
+#include <chrono>
 #include <memory>
+#include <optional>
 #include <pu/Plutonium>
-#include <set>
 #include <string>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+#include "utils/SpriteCache.hpp"
+#include "utils/SpriteDecoder.hpp"
 
 namespace pksm::utils {
 
+// A Pokemon sprite: either a region of a shared atlas page or a whole standalone texture
+struct PokemonSprite {
+    pu::sdl2::TextureHandle::Ref texture;
+    SDL_Rect sourceRect;
+
+    PokemonSprite() : texture(nullptr), sourceRect{0, 0, 0, 0} {}
+    PokemonSprite(pu::sdl2::TextureHandle::Ref texture, const SDL_Rect& sourceRect)
+      : texture(texture), sourceRect(sourceRect) {}
+
+    explicit operator bool() const { return texture != nullptr; }
+};
+
 class PokemonSpriteManager {
 public:
-    // Initialize with path to JSON metadata
-    static bool Initialize(const std::string& jsonPath);
+    // Initialize from a packed sprite atlas index if one is given and present, otherwise from the
+    // JSON metadata that lists one PNG per sprite
+    static bool Initialize(const std::string& jsonPath, const std::string& atlasIndexPath = "");
+
+    // Get the sprite for a specific Pokemon, loading it on this thread if needed
+    static PokemonSprite GetPokemonSprite(u16 species, u8 form = 0, bool shiny = false);
 
-    // Get a texture handle for a specific Pokemon
-    static pu::sdl2::TextureHandle::Ref GetPokemonSprite(u16 species, u8 form = 0, bool shiny = false);
+    // Get the sprite for a specific Pokemon without blocking. Returns std::nullopt while the
+    // sprite is being decoded in the background; call again on a later frame to pick it up.
+    static std::optional<PokemonSprite> TryGetPokemonSprite(u16 species, u8 form = 0, bool shiny = false);
+
+    // Start decoding a sprite in the background, behind any sprites requested with TryGetPokemonSprite
+    static void PrefetchPokemonSprite(u16 species, u8 form = 0, bool shiny = false);
+
+    // Upload sprites decoded in the background to textures until budget runs out. Must be called
+    // once per frame on the render thread.
+    static void ProcessDecodedSprites(std::chrono::microseconds budget = DEFAULT_UPLOAD_BUDGET);
 
     // Clean up resources
     static void Cleanup();
@@ -24,27 +54,78 @@ public:
     // Clear the sprite cache completely
     static void ClearCache();
 
-    // Release unused sprites from cache that aren't in the active list
-    static void ReleaseUnusedSprites(const std::set<std::string>& activeKeys);
+    // Set how much texture memory individually loaded sprites may keep cached
+    static void SetCacheBudget(size_t budgetBytes);
+
+    // Pack a sprite's identity into the key used by the sprite cache and the atlas index
+    static u32 GenerateKey(u16 species, u8 form, bool shiny);
 
-    // Generate a key for the sprite cache
-    static std::string GenerateKey(u16 species, u8 form, bool shiny);
+    // Enough for several boxes of sprites, so flipping between boxes never reloads them
+    static constexpr size_t DEFAULT_CACHE_BUDGET = 16 * 1024 * 1024;
+
+    // A quarter of a 60 FPS frame
+    static constexpr std::chrono::microseconds DEFAULT_UPLOAD_BUDGET{4000};
 
 private:
+    // Location of one sprite in the atlas, as stored in the atlas index
+    struct AtlasEntry {
+        u32 key;  // See GenerateKey
+        u16 page;
+        SDL_Rect rect;
+    };
+
     // Whether the manager has been initialized
     static bool initialized;
 
-    // Cache of loaded textures - key is "id-form_id-shiny"
-    static std::map<std::string, pu::sdl2::TextureHandle::Ref> spriteCache;
+    // LRU cache of textures loaded from individual files
+    static SpriteCache spriteCache;
+
+    // Mapping from pokemon data to file paths
+    static std::unordered_map<u32, std::string> spritePaths;
 
-    // Mapping from pokemon data to file paths - key is "id-form_id-shiny"
-    static std::map<std::string, std::string> spritePaths;
+    // Atlas index sorted by key, empty when sprites are loaded from individual files
+    static std::vector<AtlasEntry> atlasEntries;
+
+    // Atlas page textures, loaded on first use and then kept resident
+    static std::vector<pu::sdl2::TextureHandle::Ref> atlasPages;
+
+    // Atlas index path without its extension, which page file names are derived from
+    static std::string atlasPageBasePath;
+
+    // Background decoding of sprite files and atlas pages. Sprites are identified by their key,
+    // atlas pages by their index with ATLAS_PAGE_ID set.
+    static SpriteDecoder decoder;
+    static constexpr u32 ATLAS_PAGE_ID = 0x80000000;
+
+    // Decodes that failed, so they aren't retried every frame
+    static std::unordered_set<u32> failedDecodes;
 
     // Parse JSON metadata
     static bool ParseJsonMetadata(const std::string& jsonPath);
 
+    // Parse the binary atlas index written by tools/pack_sprite_atlas.py
+    static bool ParseAtlasIndex(const std::string& indexPath);
+
+    // Find the key of the sprite to show, falling back to the normal form and non-shiny sprites
+    static std::optional<u32> ResolveKey(u16 species, u8 form, bool shiny);
+
+    static const AtlasEntry* FindAtlasEntry(u32 key);
+
+    // Get a sprite by key, loading it on this thread if needed
+    static PokemonSprite LoadSprite(u32 key);
+
+    // Get a sprite by key if it is loaded, otherwise queue it for decoding and return std::nullopt
+    static std::optional<PokemonSprite> GetLoadedSprite(u32 key, bool urgent);
+
+    static PokemonSprite WholeTextureSprite(pu::sdl2::TextureHandle::Ref texture);
+
+    // Get an atlas page, loading it if needed
+    static pu::sdl2::TextureHandle::Ref GetAtlasPage(u16 page);
+
+    static std::string AtlasPagePath(u16 page);
+
     // Load a sprite from file
     static pu::sdl2::TextureHandle::Ref LoadSpriteFromFile(const std::string& filePath);
 };
 
-}  // namespace pksm::utils
\ No newline at end of file
+}  // namespace pksm::utils
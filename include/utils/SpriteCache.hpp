@@ -0,0 +1,64 @@
+#pragma once
+
+#include <cstddef>
+#include <pu/Plutonium>
+#include <vector>
+
+namespace pksm::utils {
+
+// Texture cache keyed by packed sprite keys. Lookups go through an open-addressing hash table with
+// linear probing, and entries form an LRU list that is trimmed to a texture memory budget.
+class SpriteCache {
+public:
+    explicit SpriteCache(size_t budgetBytes);
+
+    // Returns the cached texture and marks it most recently used, or nullptr on a miss
+    pu::sdl2::TextureHandle::Ref Get(u32 key);
+
+    // Inserts or replaces a texture, then evicts least recently used entries until the cache fits
+    // its budget. The newest entry is always kept, even if it alone exceeds the budget.
+    void Put(u32 key, pu::sdl2::TextureHandle::Ref texture);
+
+    void Clear();
+
+    void SetBudget(size_t budgetBytes);
+    size_t GetBudget() const { return budgetBytes; }
+    size_t GetMemoryUsage() const { return memoryUsage; }
+    size_t GetSize() const { return count; }
+
+private:
+    static constexpr u32 NONE = 0xFFFFFFFF;
+
+    struct Entry {
+        u32 key;
+        pu::sdl2::TextureHandle::Ref texture;
+        size_t bytes;
+        u32 prev;  // Toward most recently used
+        u32 next;  // Toward least recently used
+    };
+
+    // Slot values are indices into entries, or NONE when empty
+    std::vector<u32> slots;
+    std::vector<Entry> entries;
+    std::vector<u32> freeEntries;
+    u32 head = NONE;  // Most recently used
+    u32 tail = NONE;  // Least recently used
+    size_t count = 0;
+    size_t budgetBytes;
+    size_t memoryUsage = 0;
+
+    size_t HomeSlot(u32 key) const;
+    size_t FindSlot(u32 key) const;
+    void Grow();
+    void InsertSlot(u32 entryIndex);
+    void EraseSlot(size_t slot);
+
+    void Unlink(u32 entryIndex);
+    void PushFront(u32 entryIndex);
+    void Evict(u32 entryIndex);
+    void Trim();
+
+    static size_t TextureBytes(const pu::sdl2::TextureHandle::Ref& texture);
+};
+
+}  // namespace pksm::utils
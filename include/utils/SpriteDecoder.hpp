@@ -0,0 +1,60 @@
+#pragma once
+
+#include <SDL2/SDL.h>
+#include <condition_variable>
+#include <deque>
+#include <mutex>
+#include <pu/Plutonium>
+#include <string>
+#include <thread>
+#include <unordered_set>
+
+namespace pksm::utils {
+
+// Decodes sprite images to SDL surfaces on a worker thread. Turning a surface into a texture needs
+// the renderer, so finished surfaces are handed back to the render thread through TakeDecoded.
+class SpriteDecoder {
+public:
+    struct DecodedImage {
+        u32 id;
+        std::string path;
+        SDL_Surface* surface;  // Owned by the receiver, nullptr if decoding failed
+    };
+
+    SpriteDecoder() = default;
+    SpriteDecoder(const SpriteDecoder&) = delete;
+    SpriteDecoder& operator=(const SpriteDecoder&) = delete;
+
+    // Ensure the worker thread is stopped before the queues go away
+    ~SpriteDecoder();
+
+    void Start();
+
+    // Stop the worker thread, dropping queued jobs and freeing undelivered surfaces
+    void Stop();
+
+    // Queue an image unless it is already queued or waiting to be taken. Urgent jobs are decoded
+    // before prefetches, and queueing an already-prefetched image as urgent moves it forward.
+    void Queue(u32 id, const std::string& path, bool urgent);
+
+    // Take one decoded image, returning false if none are ready
+    bool TakeDecoded(DecodedImage& image);
+
+private:
+    struct Job {
+        u32 id;
+        std::string path;
+    };
+
+    std::thread worker;
+    std::mutex mutex;
+    std::condition_variable jobAvailable;
+    std::deque<Job> jobs;
+    std::deque<DecodedImage> decoded;
+    std::unordered_set<u32> pending;  // Queued, decoding, or decoded but not yet taken
+    bool stopping = false;
+
+    void WorkerLoop();
+};
+
+}  // namespace pksm::utils
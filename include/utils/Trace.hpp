@@ -0,0 +1,59 @@
+#pragma once
+
+#include <cstddef>
+#include <string>
+#include <switch/types.h>
+
+namespace pksm::utils {
+
+// Records timed spans into per-thread buffers and exports them as Chrome trace_event JSON, which
+// chrome://tracing and Perfetto can open. Recording takes no locks once a thread has its buffer;
+// when a thread's buffer is full further spans are dropped and counted.
+//
+// Spans are added with TRACE_SCOPE, which only records anything when built with TRACE=1.
+class Tracer {
+public:
+    struct Event {
+        const char* name;  // Must outlive the tracer, so in practice a string literal
+        u64 start;  // Monotonic time in nanoseconds
+        u64 end;
+    };
+
+    // Spans kept per thread, 24 bytes each
+    static constexpr size_t EVENTS_PER_THREAD = 8192;
+
+    static constexpr const char* DEFAULT_TRACE_PATH = "sdmc:/switch/PKSM/trace.json";
+
+    static u64 Now();
+
+    // Record a finished span on the calling thread
+    static void Record(const char* name, u64 start, u64 end);
+
+    // Write every span recorded so far to path. Threads may keep recording meanwhile; their newer
+    // spans are left out.
+    static bool WriteChromeTrace(const std::string& path);
+};
+
+// Times the enclosing scope
+class TraceScope {
+public:
+    explicit TraceScope(const char* name) : name(name), start(Tracer::Now()) {}
+    ~TraceScope() { Tracer::Record(name, start, Tracer::Now()); }
+
+    TraceScope(const TraceScope&) = delete;
+    TraceScope& operator=(const TraceScope&) = delete;
+
+private:
+    const char* name;
+    u64 start;
+};
+
+}  // namespace pksm::utils
+
+#ifdef PKSM_TRACE
+#define PKSM_TRACE_CONCAT_INNER(a, b) a##b
+#define PKSM_TRACE_CONCAT(a, b) PKSM_TRACE_CONCAT_INNER(a, b)
+#define TRACE_SCOPE(name) pksm::utils::TraceScope PKSM_TRACE_CONCAT(traceScope_, __LINE__)(name)
+#else
+#define TRACE_SCOPE(name) ((void)0)
+#endif
@@ -0,0 +1,60 @@
+#pragma once
+
+#include <fstream>
+#include <string>
+#include <switch/types.h>
+#include <vector>
+
+namespace pksm::utils {
+
+// Reads files straight out of a ZIP archive, without extracting it to disk. Opening an archive only
+// reads its central directory; entries are inflated on demand into a caller-provided buffer.
+// Supports stored and deflated entries, and ZIP64 sizes and offsets. Encrypted entries are rejected.
+class ZipReader {
+public:
+    struct Entry {
+        std::string name;  // Path inside the archive, with forward slashes
+        u16 method;        // METHOD_STORED or METHOD_DEFLATED, anything else can't be extracted
+        u16 flags;
+        u32 crc32;
+        u64 compressedSize;
+        u64 uncompressedSize;
+        u64 localHeaderOffset;
+    };
+
+    static constexpr u16 METHOD_STORED = 0;
+    static constexpr u16 METHOD_DEFLATED = 8;
+
+    // Files inside archives are addressed as "<archive path>#<entry name>"
+    static constexpr char ENTRY_SEPARATOR = '#';
+    static std::string MakeEntryPath(const std::string& archivePath, const std::string& entryName);
+
+    // Split an entry path made by MakeEntryPath, returning false for paths that don't point into a .zip
+    static bool SplitEntryPath(const std::string& path, std::string& archivePath, std::string& entryName);
+
+    // Open an archive and read its central directory. Returns false if it isn't a readable ZIP file.
+    bool Open(const std::string& path);
+
+    const std::vector<Entry>& GetEntries() const { return entries; }
+
+    // Find an entry by its path inside the archive, returning nullptr if there is none
+    const Entry* Find(const std::string& name) const;
+
+    // Decompress an entry into out, which must hold entry.uncompressedSize bytes. The data is checked
+    // against the entry's CRC-32.
+    bool Extract(const Entry& entry, u8* out);
+
+private:
+    // Compressed data is read in chunks of this size
+    static constexpr size_t READ_CHUNK_SIZE = 64 * 1024;
+
+    std::ifstream file;
+    std::string path;
+    u64 fileSize = 0;
+    std::vector<Entry> entries;
+
+    bool ReadAt(u64 offset, u8* out, size_t size);
+    bool ReadCentralDirectory(u64 offset, u64 size, u64 entryCount);
+};
+
+}  // namespace pksm::utils
@@ -1,5 +1,6 @@
 #include "PKSMApplication.hpp"
 
+#include <chrono>
 #include <sstream>
 #include <switch.h>
 
@@ -7,11 +8,14 @@
 #include "data/providers/SaveDataAccessor.hpp"
 #include "data/providers/SaveDataProvider.hpp"
 #include "data/providers/TitleDataProvider.hpp"
+#include "data/titles/TitleIconLoader.hpp"
 #include "gui/shared/FontManager.hpp"
+#include "gui/shared/GuiSettings.hpp"
 #include "gui/shared/UIConstants.hpp"
 #include "utils/Logger.hpp"
 #include "utils/NotificationManager.hpp"
 #include "utils/PokemonSpriteManager.hpp"
+#include "utils/Trace.hpp"
 
 namespace pksm {
 
@@ -58,6 +62,8 @@ void PKSMApplication::ConfigureInput(pu::ui::render::RendererInitOptions& render
 }
 
 void PKSMApplication::RegisterAdditionalFonts() {
+    TRACE_SCOPE("PKSMApplication::RegisterAdditionalFonts");
+
     LOG_DEBUG("Registering additional fonts...");
 
     try {
@@ -100,8 +106,24 @@ PKSMApplication::PKSMApplication(
     saveProvider(std::move(saveProvider)),
     saveDataAccessor(std::move(saveDataAccessor)),
     boxDataProvider(std::move(boxDataProvider)) {
-    // Add render callback to process account updates
-    AddRenderCallback([this]() { this->accountManager->ProcessPendingUpdates(); });
+    TRACE_SCOPE("PKSMApplication::PKSMApplication");
+
+    // Add render callback to process account and save list updates
+    AddRenderCallback([this]() {
+        this->accountManager->ProcessPendingUpdates();
+        this->saveProvider->ProcessPendingUpdates();
+    });
+
+    // Upload sprites and title icons decoded in the background, within a per-frame time budget
+    AddRenderCallback([this]() {
+        this->frameTimeMonitor.Tick(
+            this->GetRenderedFrameCount(),
+            this->GetSkippedFrameCount(),
+            this->renderer->GetTotalDrawCallCount()
+        );
+        pksm::utils::PokemonSpriteManager::ProcessDecodedSprites();
+        pksm::titles::TitleIconLoader::ProcessDecodedIcons();
+    });
 
     // global notifications: render above layouts/overlays
     notificationCenter = pksm::ui::NotificationCenter::New(0, 0, 640);
@@ -116,6 +138,7 @@ PKSMApplication::Ref PKSMApplication::Initialize() {
     try {
         // Initialize logger first
         utils::Logger::Initialize();
+        TRACE_SCOPE("PKSMApplication::Initialize");
         LOG_INFO("Initializing PKSM...");
         LOG_MEMORY();  // Initial memory state
 
@@ -128,17 +151,36 @@ PKSMApplication::Ref PKSMApplication::Initialize() {
         auto renderer = pu::ui::render::Renderer::New(renderer_opts);
 
         LOG_DEBUG("Initializing renderer...");
-        renderer->Initialize();
+        const auto rendererStart = std::chrono::steady_clock::now();
+        {
+            TRACE_SCOPE("Renderer::Initialize");
+            renderer->Initialize();
+        }
+        const auto rendererEnd = std::chrono::steady_clock::now();
         LOG_MEMORY();  // Memory after renderer initialization
 
         // Register additional fonts after romfs is mounted
         RegisterAdditionalFonts();
+        const auto fontsEnd = std::chrono::steady_clock::now();
+        LOG_DEBUG(
+            "Startup timing: renderer " +
+            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(rendererEnd - rendererStart).count()) +
+            "ms, additional fonts " +
+            std::to_string(std::chrono::duration_cast<std::chrono::milliseconds>(fontsEnd - rendererEnd).count()) + "ms"
+        );
+        LOG_MEMORY();  // Memory after font registration
 
         // Initialize Pokemon sprite manager (optional)
-        if (!utils::PokemonSpriteManager::Initialize("romfs:/gfx/data/data.json")) {
+        if (!utils::PokemonSpriteManager::Initialize(
+                "romfs:/gfx/data/data.json",
+                "romfs:/gfx/data/sprite_atlas.bin"
+            )) {
             LOG_WARNING("Failed to initialize sprite manager, continuing without sprites");
         }
 
+        // Apply saved interface settings before any screen is built
+        pksm::ui::AnimatedBackground::SetAnimationPaused(pksm::ui::GuiSettings::Load().backgroundAnimationPaused);
+
         auto recordingInitResult = appletInitializeGamePlayRecording();
         if (R_FAILED(recordingInitResult)) {
             LOG_ERROR("Failed to initialize game play recording");
@@ -159,10 +201,19 @@ PKSMApplication::Ref PKSMApplication::Initialize() {
         // Create data providers
         // -----------------------------
         LOG_DEBUG("Creating data providers...");
+        const auto providersStart = std::chrono::steady_clock::now();
         auto titleProviderConcrete = std::make_shared<pksm::titles::TitleDataProvider>();
         auto saveProviderConcrete = std::make_shared<SaveDataProvider>(accountManager->GetCurrentAccount());
         auto saveDataAccessorConcrete = std::make_shared<SaveDataAccessor>(accountManager->GetCurrentAccount());
-        auto boxDataProviderConcrete = std::make_shared<BoxDataProvider>();
+        auto boxDataProviderConcrete = std::make_shared<BoxDataProvider>(saveDataAccessorConcrete);
+        LOG_DEBUG(
+            "Startup timing: data providers " +
+            std::to_string(
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - providersStart)
+                    .count()
+            ) +
+            "ms"
+        );
 
         // Cast to interface types expected by PKSMApplication
         ITitleDataProvider::Ref titleProvider = std::static_pointer_cast<ITitleDataProvider>(titleProviderConcrete);
@@ -218,6 +269,8 @@ void PKSMApplication::ShowTitleLoadScreen() {
     LOG_DEBUG("Switching to title load screen");
     // unmount any save that may be mounted still from previous save load
     saveDataAccessor->unmountSaveDevice();
+    // the loaded save may have been written, so look at the saves again
+    saveProvider->InvalidateSaveIndex();
     this->LoadLayout(this->titleLoadScreen);
     // refresh the save list when returning to title load screen
     if (titleLoadScreen) {
@@ -261,6 +314,7 @@ void PKSMApplication::OnSaveSelected(pksm::titles::Title::Ref title, pksm::saves
 }
 
 void PKSMApplication::OnLoad() {
+    TRACE_SCOPE("PKSMApplication::OnLoad");
     try {
         LOG_DEBUG("Loading title screen...");
         LOG_MEMORY();
@@ -108,6 +108,7 @@ void AccountManager::ProcessPendingUpdates() {
             onAccountSelectedCallback(update.newAccount);
         }
         pendingUpdates.pop();
+        pu::ui::RequestRedraw();
     }
 }
 
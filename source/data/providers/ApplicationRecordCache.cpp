@@ -0,0 +1,45 @@
+#include "data/providers/ApplicationRecordCache.hpp"
+
+#include "utils/Logger.hpp"
+
+namespace pksm::titles {
+
+ApplicationRecordCache::ApplicationRecordCache(IApplicationRecordSource::Ref source) : source(std::move(source)) {}
+
+void ApplicationRecordCache::Invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    valid = false;
+}
+
+bool ApplicationRecordCache::IsInstalled(u64 titleId) {
+    std::lock_guard<std::mutex> lock(mutex);
+    RefreshIfStale();
+    return installedIds.contains(titleId);
+}
+
+void ApplicationRecordCache::RefreshIfStale() {
+    if (!source) {
+        return;
+    }
+
+    // Read the sequence before listing, so a change that lands mid-list triggers another refresh
+    const u64 currentSequence = source->GetChangeSequence();
+    if (valid && currentSequence == sequence) {
+        return;
+    }
+
+    installedIds.clear();
+    if (!source->ListApplicationIds(listBuffer)) {
+        // Stay invalid so the next query tries again
+        LOG_ERROR("Failed to list installed applications");
+        valid = false;
+        return;
+    }
+
+    installedIds.insert(listBuffer.begin(), listBuffer.end());
+    sequence = currentSequence;
+    valid = true;
+    LOG_DEBUG("Installed application list refreshed, " + std::to_string(installedIds.size()) + " applications");
+}
+
+}  // namespace pksm::titles
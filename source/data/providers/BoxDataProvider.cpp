@@ -2,52 +2,27 @@
 
 #include <algorithm>
 #include <cctype>
-#include <filesystem>
-#include <fstream>
 #include <sstream>
 #include <stdexcept>
 #include <vector>
 
 #include <switch.h>
 
+#include "data/saves/SaveReader.hpp"
 #include "pksmcore/pkx/PKX.hpp"
 #include "pksmcore/sav/Sav.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 namespace {
 
 std::unique_ptr<pksm::Sav> LoadSavFromPath(const std::string &save_name) {
-    const bool isSaveDevicePath = save_name.rfind("save:/", 0) == 0;
-    const std::string savePath = isSaveDevicePath ? save_name : (std::string("save:/") + save_name);
+    const std::string savePath =
+        (save_name.find(":/") == std::string::npos) ? (std::string("save:/") + save_name) : save_name;
 
-    if (!std::filesystem::exists(savePath)) {
-        throw std::runtime_error("Save file does not exist: " + savePath);
-    }
-
-    std::ifstream in(savePath, std::ios::binary | std::ios::ate);
-    if (!in.good()) {
-        throw std::runtime_error("Failed to open save file: " + savePath);
-    }
-
-    const std::streamsize size = in.tellg();
-    if (size <= 0) {
-        throw std::runtime_error("Invalid save file size: " + savePath);
-    }
-
-    in.seekg(0, std::ios::beg);
-
-    std::vector<u8> buffer_vec;
-    buffer_vec.resize(size);
-    if (!in.read(reinterpret_cast<char*>(buffer_vec.data()), size)) {
-        throw std::runtime_error("Failed to read save file: " + savePath);
-    }
-
-    auto buffer = std::shared_ptr<u8[]>(new u8[size], std::default_delete<u8[]>());
-    std::copy(buffer_vec.begin(), buffer_vec.end(), buffer.get());
-
-    auto sav = pksm::Sav::getSave(buffer, static_cast<size_t>(size));
+    auto sav = pksm::saves::SaveReader::Load(savePath);
     if (!sav) {
-        throw std::runtime_error("PKSM-Core could not detect a valid save type");
+        throw std::runtime_error("Failed to load save: " + savePath);
     }
 
     return sav;
@@ -55,7 +30,8 @@ std::unique_ptr<pksm::Sav> LoadSavFromPath(const std::string &save_name) {
 
 } // namespace
 
-BoxDataProvider::BoxDataProvider() = default;
+BoxDataProvider::BoxDataProvider(ISaveDataAccessor::Ref saveDataAccessor)
+    : saveDataAccessor(std::move(saveDataAccessor)) {}
 
 BoxDataProvider::~BoxDataProvider() = default;
 
@@ -66,6 +42,15 @@ pksm::Sav* BoxDataProvider::GetSavForSaveData(const pksm::saves::SaveData::Ref&
         return nullptr;
     }
 
+    // The accessor already parsed the loaded save, so it isn't read a second time
+    if (saveDataAccessor && (saveDataAccessor->getCurrentSaveData() == saveData)) {
+        if (auto *sav = saveDataAccessor->getCurrentSav()) {
+            cachedSav.reset();
+            cachedSaveName.clear();
+            return sav;
+        }
+    }
+
     const auto &save_name = saveData->getName();
     if (cachedSav && (cachedSaveName == save_name)) {
         return cachedSav.get();
@@ -102,6 +87,7 @@ size_t BoxDataProvider::GetBoxCount(const pksm::saves::SaveData::Ref& saveData)
 }
 
 pksm::ui::BoxData BoxDataProvider::GetBoxData(const pksm::saves::SaveData::Ref& saveData, int boxIndex) const {
+    TRACE_SCOPE("BoxDataProvider::GetBoxData");
     return LoadBoxDataFromSave(saveData, boxIndex);
 }
 
@@ -0,0 +1,68 @@
+#include "data/providers/NsApplicationRecordSource.hpp"
+
+#include "utils/Logger.hpp"
+
+namespace pksm::titles {
+
+NsApplicationRecordSource::NsApplicationRecordSource() {
+    Result rc = nsInitialize();
+    if (R_FAILED(rc)) {
+        LOG_ERROR("Failed to initialize ns, installed titles won't be listed");
+        return;
+    }
+    nsReady = true;
+
+    // Without the event the records are only listed again after an explicit invalidate
+    rc = nsGetApplicationRecordUpdateSystemEvent(&updateEvent);
+    hasUpdateEvent = R_SUCCEEDED(rc);
+    if (!hasUpdateEvent) {
+        LOG_WARNING("Application record update event unavailable, installs won't be noticed");
+    }
+}
+
+NsApplicationRecordSource::~NsApplicationRecordSource() {
+    if (hasUpdateEvent) {
+        eventClose(&updateEvent);
+    }
+    if (nsReady) {
+        nsExit();
+    }
+}
+
+bool NsApplicationRecordSource::ListApplicationIds(std::vector<u64>& outIds) {
+    if (!nsReady) {
+        return false;
+    }
+
+    records.resize(RECORDS_PER_CALL);
+    outIds.clear();
+
+    // Page through the records so any number of installed applications is listed
+    for (s32 offset = 0;; offset += RECORDS_PER_CALL) {
+        s32 count = 0;
+        Result rc = nsListApplicationRecord(records.data(), RECORDS_PER_CALL, offset, &count);
+        if (R_FAILED(rc)) {
+            return false;
+        }
+
+        for (s32 i = 0; i < count; i++) {
+            if (records[i].application_id) {
+                outIds.push_back(records[i].application_id);
+            }
+        }
+
+        if (count < RECORDS_PER_CALL) {
+            return true;
+        }
+    }
+}
+
+u64 NsApplicationRecordSource::GetChangeSequence() {
+    if (hasUpdateEvent && R_SUCCEEDED(eventWait(&updateEvent, 0))) {
+        eventClear(&updateEvent);
+        sequence++;
+    }
+    return sequence;
+}
+
+}  // namespace pksm::titles
@@ -1,18 +1,18 @@
 #include "data/providers/SaveDataAccessor.hpp"
 
 #include <algorithm>
-#include <filesystem>
-#include <fstream>
-#include <sstream>
 #include <stdexcept>
 
 #include <switch.h>
 
+#include "data/saves/FsdevSaveMounter.hpp"
+#include "data/saves/SaveReader.hpp"
 #include "pksmcore/enums/GameVersion.hpp"
 #include "pksmcore/enums/Generation.hpp"
 #include "pksmcore/enums/Gender.hpp"
 #include "pksmcore/sav/Sav.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 using namespace pksm;
 
@@ -174,19 +174,19 @@ pksm::saves::GameVersion ToAppGameVersion(pksm::GameVersion version) {
 
 }  // namespace
 
-SaveDataAccessor::SaveDataAccessor(AccountUid currentUserId)
-  : currentSave(nullptr), hasChanges(false), currentUserId(currentUserId) {}
+SaveDataAccessor::SaveDataAccessor(AccountUid currentUserId, ISaveMounter::Ref saveMounter)
+  : currentSave(nullptr),
+    currentTitleId(0),
+    hasChanges(false),
+    currentUserId(currentUserId),
+    saveMounter(saveMounter ? std::move(saveMounter) : std::make_shared<pksm::saves::FsdevSaveMounter>()),
+    saveWriter(this->saveMounter) {}
+
+SaveDataAccessor::~SaveDataAccessor() = default;
 
 void SaveDataAccessor::unmountSaveDevice() {
     LOG_DEBUG("Unmounting save device");
-    Result rc = fsdevUnmountDevice("save");
-    if (R_FAILED(rc)) {
-        std::stringstream hexStream;
-        hexStream << std::hex << rc;
-        LOG_DEBUG("Save device was not mounted or unmount failed: " + std::to_string(rc) + " (0x" + hexStream.str() + ")");
-    } else {
-        LOG_DEBUG("Successfully unmounted save device");
-    }
+    saveMounter->Unmount();
 }
 
 pksm::saves::SaveData::Ref SaveDataAccessor::getCurrentSaveData() const {
@@ -198,13 +198,21 @@ bool SaveDataAccessor::loadSave(const pksm::titles::Title::Ref title, const std:
         return false;
     }
 
-    auto loaded = LoadSaveDataFromFile(title, saveName);
+    std::unique_ptr<pksm::Sav> loadedSav;
+    std::string filePath;
+    auto loaded = LoadSaveDataFromFile(title, saveName, loadedSav, filePath);
     if (!loaded) {
         this->unmountSaveDevice();
         return false;
     }
 
     currentSave = loaded;
+    currentSav = std::move(loadedSav);
+    currentTitleId = title->getTitleId();
+    currentFilePath = filePath;
+    currentDestination = pksm::saves::SaveWriter::IsSaveDevicePath(pksm::saves::SaveWriter::ResolveSavePath(saveName))
+        ? pksm::saves::SaveWriter::Destination::MountedSave
+        : pksm::saves::SaveWriter::Destination::SdCard;
     hasChanges = false;
 
     if (onSaveDataChanged) {
@@ -215,15 +223,29 @@ bool SaveDataAccessor::loadSave(const pksm::titles::Title::Ref title, const std:
 }
 
 bool SaveDataAccessor::saveChanges() {
-    if (!currentSave) {
+    if (!currentSave || !currentSav) {
         LOG_ERROR("No save data to save");
         return false;
     }
 
-    // TODO: Implement actual save writing using PKSM-Core
-    // for now, just mark as saved
+    pksm::saves::SaveWriter::Timing timing;
+    if (!saveWriter.Write(*currentSav, currentTitleId, currentFilePath, currentDestination, &timing)) {
+        LOG_ERROR("Failed to write save: " + currentSave->getName());
+        if (currentDestination == pksm::saves::SaveWriter::Destination::MountedSave) {
+            // Remounting throws away what was written without a commit, so the save is as loaded
+            saveMounter->Unmount();
+            if (!saveMounter->Mount(currentTitleId, mountedUserId)) {
+                LOG_ERROR("Failed to remount save after a failed write: " + currentSave->getName());
+            }
+        }
+        return false;
+    }
+
     hasChanges = false;
-    LOG_DEBUG("Save changes requested (not fully implemented)");
+    LOG_DEBUG(
+        "Saved " + currentSave->getName() + " in " + std::to_string(timing.total.count()) + "us (finishEditing " +
+        std::to_string(timing.finishEditing.count()) + "us)"
+    );
     return true;
 }
 
@@ -233,110 +255,43 @@ bool SaveDataAccessor::hasUnsavedChanges() const {
 
 pksm::saves::SaveData::Ref SaveDataAccessor::LoadSaveDataFromFile(
     const pksm::titles::Title::Ref& title,
-    const std::string& saveName
-) const {
+    const std::string& saveName,
+    std::unique_ptr<pksm::Sav>& loadedSav,
+    std::string& filePath
+) {
+    TRACE_SCOPE("SaveDataAccessor::LoadSaveDataFromFile");
     if (!title) {
         return nullptr;
     }
 
-    const bool isSaveDevicePath = saveName.rfind("save:/", 0) == 0;
-    const std::string savePath = isSaveDevicePath ? saveName : (std::string("save:/") + saveName);
+    // Bare file names are files in the console save, the same as for the writer
+    const std::string savePath = pksm::saves::SaveWriter::ResolveSavePath(saveName);
+    filePath = savePath;
 
-    if (isSaveDevicePath) {
+    if (pksm::saves::SaveWriter::IsSaveDevicePath(savePath)) {
         LOG_DEBUG("Mounting save data for title ID: " + std::to_string(title->getTitleId()) + 
                   " user ID: " + std::to_string(currentUserId.uid[1]) + 
                   " save path: " + savePath);
-        
+    
         // Mount save data for read-write access
-        Result rc = fsdevMountSaveData("save", title->getTitleId(), currentUserId);
-        if (R_FAILED(rc)) {
-            std::stringstream hexStream;
-            hexStream << std::hex << rc;
-            LOG_ERROR("Failed to mount save data. Title ID: " + std::to_string(title->getTitleId()) + 
-                      " Result: " + std::to_string(rc) + " (0x" + hexStream.str() + ")");
+        const auto root = saveMounter->Mount(title->getTitleId(), currentUserId);
+        if (!root) {
+            LOG_ERROR("Failed to mount save data. Title ID: " + std::to_string(title->getTitleId()));
             return nullptr;
         }
+        mountedUserId = currentUserId;
+        filePath = *root + savePath.substr(std::char_traits<char>::length(pksm::saves::SaveWriter::SAVE_DEVICE_PREFIX));
         LOG_DEBUG("Successfully mounted save data");
     }
 
-    if (!std::filesystem::exists(savePath)) {
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
-        LOG_ERROR("Save file does not exist: " + savePath);
-        return nullptr;
-    }
-
-    std::ifstream in(savePath, std::ios::binary | std::ios::ate);
-    if (!in.good()) {
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
-        LOG_ERROR("Failed to open save file: " + savePath);
-        return nullptr;
-    }
-
-    const std::streamsize size = in.tellg();
-    if (size <= 0) {
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
-        LOG_ERROR("Invalid save file size: " + savePath);
-        return nullptr;
-    }
-
-    in.seekg(0, std::ios::beg);
-
-    std::vector<u8> buffer_vec;
-    try {
-        buffer_vec.resize(size);
-        if (!in.read(reinterpret_cast<char*>(buffer_vec.data()), size)) {
-            if (isSaveDevicePath) {
-                fsdevUnmountDevice("save");
-            }
-            LOG_ERROR("Failed to read save file: " + savePath);
-            return nullptr;
-        }
-    } catch (const std::bad_alloc& e) {
-        LOG_ERROR("Memory allocation failed while reading save: " + std::string(e.what()));
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
+    // Logs how long the read and parse took; loadSave unmounts the save if this fails
+    std::unique_ptr<pksm::Sav> sav = pksm::saves::SaveReader::Load(filePath);
+    if (!sav) {
         return nullptr;
     }
 
-    std::shared_ptr<u8[]> buffer;
-    try {
-        buffer = std::shared_ptr<u8[]>(new u8[size], std::default_delete<u8[]>());
-        std::copy(buffer_vec.begin(), buffer_vec.end(), buffer.get());
-    } catch (const std::bad_alloc& e) {
-        LOG_ERROR("Memory allocation failed for PKSM-Core buffer: " + std::string(e.what()));
-        return nullptr;
-    }
-    
     // keep device mounted for StorageScreen access, don't unmount here
 
-    std::unique_ptr<pksm::Sav> sav;
-    try {
-        sav = pksm::Sav::getSave(buffer, static_cast<size_t>(size));
-    } catch (const std::exception& e) {
-        LOG_ERROR("PKSM-Core failed to parse save: " + std::string(e.what()));
-        LOG_ERROR("This save file may be corrupted, incompatible, or from an unsupported game.");
-        LOG_ERROR("Please try selecting a different save file or check if the game is properly installed.");
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
-        return nullptr;
-    }
-
-    if (!sav) {
-        LOG_ERROR("PKSM-Core could not detect a valid save type");
-        if (isSaveDevicePath) {
-            fsdevUnmountDevice("save");
-        }
-        return nullptr;
-    }
-
     const auto generation = ToAppGeneration(sav->generation());
     const auto version = ToAppGameVersion(sav->version());
     const auto gender = ToAppGender(sav->gender());
@@ -403,5 +358,6 @@ pksm::saves::SaveData::Ref SaveDataAccessor::LoadSaveDataFromFile(
     }
 
     save_data->setBagItems(std::move(bag_items));
+    loadedSav = std::move(sav);
     return save_data;
 }
\ No newline at end of file
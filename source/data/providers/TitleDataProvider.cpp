@@ -1,76 +1,20 @@
 #include "TitleDataProvider.hpp"
+#include "data/providers/NsApplicationRecordSource.hpp"
 #include <fstream>
 #include <filesystem>
-#include <set>
 #include <vector>
 #include <cstring>
 #include <stdio.h>
 
 #include <switch.h>
 
-#include <nlohmann/json.hpp>
-
 namespace pksm::titles {
 
-static constexpr const char* JSON_PATH = "romfs:/gfx/data/data.json";
-
-void TitleDataProvider::GetInstalledApplicationIds(std::set<u64>& out_ids) const {
-    Result rc = nsInitialize();
-    if (R_FAILED(rc)) return;
-
-    constexpr size_t MAX_ENTRIES = 0x400; // 1024 entries
-    constexpr size_t BUFFER_SIZE = (sizeof(NsApplicationRecord) * MAX_ENTRIES);
-
-    auto records = reinterpret_cast<NsApplicationRecord*>(std::calloc(1, BUFFER_SIZE));
-    if (!records) {
-        nsExit();
-        return;
-    }
-
-    s32 count = 0;
-
-    rc = nsListApplicationRecord(records, MAX_ENTRIES, 0, &count);
-    if (R_SUCCEEDED(rc)) {
-        out_ids.clear();
-        for (s32 i = 0; i < count; i++) {
-           NsApplicationRecord* cur_record = &(records[i]);
-           if (cur_record->application_id) out_ids.insert(cur_record->application_id);
-        }
-    }
-
-    // Cleanup
-
-    std::free(records);
-    nsExit();
-}
-
-TitleDataProvider::TitleDataProvider()
-    : mockCartridgeTitle(nullptr)
+TitleDataProvider::TitleDataProvider(IApplicationRecordSource::Ref recordSource)
+    : catalogue(TitleCatalogue::Get()),
+      installedApplications(recordSource ? std::move(recordSource) : std::make_shared<NsApplicationRecordSource>()),
+      mockCartridgeTitle(nullptr)
 {
-    try {
-        std::ifstream f(JSON_PATH);
-        if (f.is_open()) {
-            nlohmann::json j;
-            f >> j;
-
-            // load all console titles from JSON
-            for (const auto& game : j["games"]) {
-                if (game["category"] != "console") continue;
-
-                u64 titleId = 0;
-                try { titleId = std::stoull(game["title_id"].get<std::string>(), nullptr, 16); }
-                catch (...) { continue; }
-
-                std::string name = game["name"].get<std::string>();
-                std::string iconPath = game["icon_path"].get<std::string>();
-
-                installedTitles.push_back(std::make_shared<Title>(name, iconPath, titleId));
-            }
-        }
-    } catch (...) {
-        installedTitles.clear();
-    }
-
     try {
         mockCartridgeTitle = std::make_shared<Title>(
             "Pokémon Legends: Arceus",
@@ -93,23 +37,20 @@ Title::Ref TitleDataProvider::GetGameCardTitle() const {
 }
 
 std::vector<Title::Ref> TitleDataProvider::GetInstalledTitles(const AccountUid& /*userId*/) const {
-
-    std::set<u64> installedIds;
-    GetInstalledApplicationIds(installedIds);
-
-    std::vector<std::shared_ptr<Title>> filteredList;
-    filteredList.reserve(installedTitles.size());
-
-    for (const auto& t : installedTitles) {
-        if (!t) continue;
-
-        if (installedIds.find(t->getTitleId()) != installedIds.end()) {
-            filteredList.push_back(t);
-        }
+    // return the catalogue titles that are installed, in catalogue order
+    std::vector<Title::Ref> catalogueTitles;
+    catalogueTitles.reserve(catalogue->GetEntries().size());
+    for (const auto& entry : catalogue->GetEntries()) {
+        catalogueTitles.push_back(entry.title);
     }
 
-    // return the filtered list of installed titles only
-    return filteredList;
+    return installedApplications.FilterInstalled(catalogueTitles, [](const Title::Ref& title) {
+        return title->getTitleId();
+    });
+}
+
+void TitleDataProvider::InvalidateInstalledTitles() {
+    installedApplications.Invalidate();
 }
 
 std::vector<Title::Ref> TitleDataProvider::GetEmulatorTitles() const {
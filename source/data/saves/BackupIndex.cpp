@@ -0,0 +1,270 @@
+#include "data/saves/BackupIndex.hpp"
+
+#include <algorithm>
+#include <cctype>
+#include <chrono>
+#include <filesystem>
+
+#include "utils/Logger.hpp"
+#include "utils/ZipReader.hpp"
+
+namespace pksm::saves {
+
+namespace {
+
+// Hash of the names in a directory, in sorted order so it doesn't depend on the listing order.
+// Returns false if the directory can't be listed.
+//
+// Only names go in, so a backup that is overwritten under the same name keeps the folder's
+// signature and isn't listed again. The index only keeps the names of the files in a backup, which
+// stay the same when a backup manager overwrites a backup of the same game, so that is accepted in
+// exchange for not reading every backup on each scan.
+bool GetListingSignature(const std::string& path, size_t& signature) {
+    std::vector<std::string> names;
+    std::error_code ec;
+    for (std::filesystem::directory_iterator it(path, ec), end; !ec && it != end; it.increment(ec)) {
+        names.push_back(it->path().filename().string());
+    }
+    if (ec) {
+        return false;
+    }
+    std::sort(names.begin(), names.end());
+
+    // Names can't contain a slash, so joining on one keeps different listings apart
+    std::string joined;
+    for (const auto& name : names) {
+        joined += name;
+        joined += '/';
+    }
+    signature = std::hash<std::string>{}(joined);
+    return true;
+}
+
+bool EndsWith(const std::string& value, const std::string& suffix) {
+    return value.size() >= suffix.size() && value.compare(value.size() - suffix.size(), suffix.size(), suffix) == 0;
+}
+
+}  // namespace
+
+bool BackupInfo::HasFile(const std::string& file) const {
+    return std::find(files.begin(), files.end(), file) != files.end();
+}
+
+u64 ParseBackupFolderTitleId(const std::string& folderName) {
+    size_t runStart = 0;
+    for (size_t i = 0; i <= folderName.size(); i++) {
+        if (i < folderName.size() && std::isxdigit(static_cast<unsigned char>(folderName[i]))) {
+            continue;
+        }
+        // Longer runs aren't title ids
+        if (i - runStart == 16) {
+            return std::stoull(folderName.substr(runStart, 16), nullptr, 16);
+        }
+        runStart = i + 1;
+    }
+    return 0;
+}
+
+std::vector<BackupRoot> BackupIndex::DefaultRoots() {
+    return {{"sdmc:/switch/Checkpoint/saves", "[Backup]"}, {"sdmc:/JKSV", "[JKSV]"}};
+}
+
+BackupIndex::BackupIndex(std::vector<BackupRoot> roots) : roots(std::move(roots)), rootStates(this->roots.size()) {}
+
+BackupIndex::~BackupIndex() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    scanRequested.notify_all();
+    scanFinished.notify_all();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+}
+
+void BackupIndex::Refresh() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        scanPending = true;
+        if (!worker.joinable()) {
+            worker = std::thread(&BackupIndex::WorkerLoop, this);
+        }
+    }
+    scanRequested.notify_one();
+}
+
+void BackupIndex::WaitForScan() {
+    std::unique_lock<std::mutex> lock(mutex);
+    scanFinished.wait(lock, [this]() { return stopping || (!scanPending && !scanning); });
+}
+
+std::vector<BackupInfo> BackupIndex::GetBackups(u64 titleId) const {
+    std::vector<const FolderState*> matches;
+    std::lock_guard<std::mutex> lock(mutex);
+    for (const auto& [path, folder] : folders) {
+        if (folder.titleId == titleId) {
+            matches.push_back(&folder);
+        }
+    }
+    std::stable_sort(matches.begin(), matches.end(), [](const FolderState* a, const FolderState* b) {
+        return a->rootIndex < b->rootIndex;
+    });
+
+    std::vector<BackupInfo> backups;
+    for (const auto* folder : matches) {
+        backups.insert(backups.end(), folder->backups.begin(), folder->backups.end());
+    }
+    return backups;
+}
+
+void BackupIndex::SetListener(Listener listener) {
+    this->listener = std::move(listener);
+}
+
+void BackupIndex::ProcessUpdates() {
+    std::set<u64> titles;
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        titles.swap(updatedTitles);
+    }
+
+    if (listener) {
+        for (u64 titleId : titles) {
+            listener(titleId);
+        }
+    }
+}
+
+void BackupIndex::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        scanRequested.wait(lock, [this]() { return stopping || scanPending; });
+        if (stopping) {
+            return;
+        }
+
+        scanPending = false;
+        scanning = true;
+
+        // Scan without holding the lock so results can be read while it runs
+        lock.unlock();
+        const auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < roots.size(); i++) {
+            ScanRoot(i);
+        }
+        LOG_DEBUG(
+            "Backup scan finished in " +
+            std::to_string(
+                std::chrono::duration_cast<std::chrono::milliseconds>(std::chrono::steady_clock::now() - start).count()
+            ) +
+            "ms"
+        );
+        lock.lock();
+
+        scanning = false;
+        scanFinished.notify_all();
+    }
+}
+
+void BackupIndex::ScanRoot(size_t rootIndex) {
+    const BackupRoot& root = roots[rootIndex];
+    RootState& state = rootStates[rootIndex];
+
+    // Listing the root is a single directory read, so it is done on every scan
+    std::vector<std::string> currentFolders;
+    std::error_code ec;
+    if (std::filesystem::is_directory(root.path, ec)) {
+        try {
+            for (const auto& entry : std::filesystem::directory_iterator(root.path)) {
+                if (entry.is_directory() && ParseBackupFolderTitleId(entry.path().filename().string()) != 0) {
+                    currentFolders.push_back(entry.path().string());
+                }
+            }
+        } catch (const std::exception& e) {
+            LOG_ERROR("Failed to list backups in " + root.path + ": " + std::string(e.what()));
+        }
+    }
+
+    // Drop folders that are gone
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        for (const auto& folderPath : state.folders) {
+            if (std::find(currentFolders.begin(), currentFolders.end(), folderPath) != currentFolders.end()) {
+                continue;
+            }
+            auto folderIt = folders.find(folderPath);
+            if (folderIt != folders.end()) {
+                updatedTitles.insert(folderIt->second.titleId);
+                folders.erase(folderIt);
+            }
+        }
+    }
+
+    state.folders = std::move(currentFolders);
+
+    for (const auto& folderPath : state.folders) {
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            if (stopping) {
+                return;
+            }
+        }
+
+        // Only the names are read here; the backups themselves are listed when these change
+        size_t listingSignature = 0;
+        if (!GetListingSignature(folderPath, listingSignature)) {
+            continue;
+        }
+
+        {
+            std::lock_guard<std::mutex> lock(mutex);
+            auto folderIt = folders.find(folderPath);
+            if (folderIt != folders.end() && folderIt->second.listingSignature == listingSignature) {
+                continue;
+            }
+        }
+
+        const u64 titleId = ParseBackupFolderTitleId(std::filesystem::path(folderPath).filename().string());
+        ScanFolder(folderPath, listingSignature, titleId, rootIndex);
+    }
+}
+
+void BackupIndex::ScanFolder(const std::string& folderPath, size_t listingSignature, u64 titleId, size_t rootIndex) {
+    const BackupRoot& root = roots[rootIndex];
+    FolderState folder{listingSignature, titleId, rootIndex, {}};
+
+    try {
+        for (const auto& entry : std::filesystem::directory_iterator(folderPath)) {
+            const std::string backupName = entry.path().filename().string();
+            if (entry.is_directory()) {
+                BackupInfo backup{root.label, backupName, entry.path().string(), false, {}};
+                for (const auto& file : std::filesystem::directory_iterator(entry.path())) {
+                    if (file.is_regular_file()) {
+                        backup.files.push_back(file.path().filename().string());
+                    }
+                }
+                folder.backups.push_back(std::move(backup));
+            } else if (EndsWith(backupName, ".zip")) {
+                // Only the central directory is read; nothing is extracted until the backup is loaded
+                BackupInfo backup{root.label, backupName, entry.path().string(), true, {}};
+                utils::ZipReader zip;
+                if (zip.Open(backup.path)) {
+                    for (const auto& zipEntry : zip.GetEntries()) {
+                        backup.files.push_back(zipEntry.name);
+                    }
+                }
+                folder.backups.push_back(std::move(backup));
+            }
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to list backups in " + folderPath + ": " + std::string(e.what()));
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    folders[folderPath] = std::move(folder);
+    updatedTitles.insert(titleId);
+}
+
+}  // namespace pksm::saves
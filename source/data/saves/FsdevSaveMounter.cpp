@@ -0,0 +1,38 @@
+#include "data/saves/FsdevSaveMounter.hpp"
+
+#include <sstream>
+
+#include "utils/Logger.hpp"
+
+namespace pksm::saves {
+
+std::optional<std::string> FsdevSaveMounter::Mount(u64 titleId, const AccountUid& uid) {
+    // Ensure device is not left mounted/busy from previous operations
+    fsdevUnmountDevice("save");
+
+    Result rc = fsdevMountSaveData("save", titleId, uid);
+    if (R_FAILED(rc)) {
+        std::stringstream hexStream;
+        hexStream << std::hex << rc;
+        LOG_DEBUG("No save data to mount. Result: " + std::to_string(rc) + " (0x" + hexStream.str() + ")");
+        return std::nullopt;
+    }
+    return "save:/";
+}
+
+void FsdevSaveMounter::Unmount() {
+    fsdevUnmountDevice("save");
+}
+
+bool FsdevSaveMounter::Commit() {
+    Result rc = fsdevCommitDevice("save");
+    if (R_FAILED(rc)) {
+        std::stringstream hexStream;
+        hexStream << std::hex << rc;
+        LOG_ERROR("Failed to commit save data. Result: " + std::to_string(rc) + " (0x" + hexStream.str() + ")");
+        return false;
+    }
+    return true;
+}
+
+}  // namespace pksm::saves
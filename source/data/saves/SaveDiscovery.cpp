@@ -0,0 +1,97 @@
+#include "data/saves/SaveDiscovery.hpp"
+
+#include <chrono>
+#include <filesystem>
+#include <tuple>
+
+#include "utils/Logger.hpp"
+
+namespace pksm::saves {
+
+const SaveFileInfo* SaveIndexEntry::Find(const std::string& path) const {
+    for (const auto& file : files) {
+        if (file.path == path) {
+            return &file;
+        }
+    }
+    return nullptr;
+}
+
+bool SaveDiscovery::Key::operator<(const Key& other) const {
+    return std::tie(titleId, uid[0], uid[1]) < std::tie(other.titleId, other.uid[0], other.uid[1]);
+}
+
+SaveDiscovery::SaveDiscovery(ISaveMounter::Ref mounter) : mounter(std::move(mounter)) {}
+
+SaveIndexEntry SaveDiscovery::Discover(u64 titleId, const AccountUid& uid) {
+    std::lock_guard<std::mutex> lock(mutex);
+
+    const Key key = MakeKey(titleId, uid);
+    auto entryIt = index.find(key);
+    if (entryIt == index.end()) {
+        entryIt = index.emplace(key, IndexSave(titleId, uid)).first;
+    }
+    return entryIt->second;
+}
+
+void SaveDiscovery::Invalidate() {
+    std::lock_guard<std::mutex> lock(mutex);
+    index.clear();
+}
+
+void SaveDiscovery::Invalidate(u64 titleId, const AccountUid& uid) {
+    std::lock_guard<std::mutex> lock(mutex);
+    index.erase(MakeKey(titleId, uid));
+}
+
+SaveDiscovery::Key SaveDiscovery::MakeKey(u64 titleId, const AccountUid& uid) {
+    return {titleId, {uid.uid[0], uid.uid[1]}};
+}
+
+SaveIndexEntry SaveDiscovery::IndexSave(u64 titleId, const AccountUid& uid) {
+    SaveIndexEntry entry;
+    if (!mounter) {
+        return entry;
+    }
+
+    const auto root = mounter->Mount(titleId, uid);
+    if (!root) {
+        return entry;
+    }
+    entry.exists = true;
+    entry.root = *root;
+
+    // Saves hold a handful of files, so listing all of them costs little more than the mount
+    try {
+        const std::filesystem::path rootPath(*root);
+        for (const auto& file : std::filesystem::recursive_directory_iterator(rootPath)) {
+            if (!file.is_regular_file()) {
+                continue;
+            }
+
+            SaveFileInfo info{file.path().lexically_relative(rootPath).generic_string(), 0, 0};
+
+            std::error_code ec;
+            const auto size = file.file_size(ec);
+            if (!ec) {
+                info.size = static_cast<u64>(size);
+            }
+            const auto writeTime = file.last_write_time(ec);
+            if (!ec) {
+                info.modified =
+                    std::chrono::system_clock::to_time_t(std::chrono::file_clock::to_sys(writeTime));
+            }
+
+            entry.files.push_back(std::move(info));
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Failed to list save files: " + std::string(e.what()));
+    }
+
+    mounter->Unmount();
+
+    LOG_DEBUG("Indexed save with " + std::to_string(entry.files.size()) + " files");
+    return entry;
+}
+
+}  // namespace pksm::saves
@@ -0,0 +1,154 @@
+#include "data/saves/SaveReader.hpp"
+
+#include <algorithm>
+#include <cstdio>
+#include <new>
+#include <sys/stat.h>
+
+#include "data/saves/SaveWriter.hpp"
+#include "pksmcore/sav/Sav.hpp"
+#include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
+#include "utils/ZipReader.hpp"
+
+namespace pksm::saves {
+
+namespace {
+
+std::chrono::microseconds ElapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+std::shared_ptr<u8[]> AllocateSaveBuffer(size_t size) {
+    try {
+        return std::shared_ptr<u8[]>(new u8[size], std::default_delete<u8[]>());
+    } catch (const std::bad_alloc& e) {
+        LOG_ERROR("Memory allocation failed for PKSM-Core buffer: " + std::string(e.what()));
+        return nullptr;
+    }
+}
+
+}  // namespace
+
+double SaveReader::Timing::ReadThroughput() const {
+    return (read.count() > 0) ? static_cast<double>(bytes) / static_cast<double>(read.count()) : 0.0;
+}
+
+std::shared_ptr<u8[]> SaveReader::ReadFile(const std::string& path, size_t& size) {
+    FILE* file = std::fopen(path.c_str(), "rb");
+    if (!file && SaveWriter::RecoverInterruptedWrite(path)) {
+        file = std::fopen(path.c_str(), "rb");
+    }
+    if (!file) {
+        LOG_ERROR("Failed to open save file: " + path);
+        return nullptr;
+    }
+
+    struct stat fileStat;
+    if ((fstat(fileno(file), &fileStat) != 0) || (fileStat.st_size <= 0)) {
+        std::fclose(file);
+        LOG_ERROR("Invalid save file size: " + path);
+        return nullptr;
+    }
+    size = static_cast<size_t>(fileStat.st_size);
+
+    auto buffer = AllocateSaveBuffer(size);
+    if (!buffer) {
+        std::fclose(file);
+        return nullptr;
+    }
+
+    // Every read lands in the final buffer, so stdio's own buffer would only add a copy
+    std::setvbuf(file, nullptr, _IONBF, 0);
+    size_t offset = 0;
+    while (offset < size) {
+        const size_t chunk = std::min(READ_CHUNK_SIZE, size - offset);
+        const size_t read = std::fread(buffer.get() + offset, 1, chunk, file);
+        offset += read;
+        if (read != chunk) {
+            break;
+        }
+    }
+    std::fclose(file);
+
+    if (offset != size) {
+        LOG_ERROR("Failed to read save file: " + path);
+        return nullptr;
+    }
+    return buffer;
+}
+
+std::unique_ptr<pksm::Sav> SaveReader::Load(const std::string& path, Timing* timing) {
+    TRACE_SCOPE("SaveReader::Load");
+    Timing localTiming;
+    Timing& stats = timing ? *timing : localTiming;
+    stats = Timing{};
+    const auto start = std::chrono::steady_clock::now();
+
+    std::string archivePath;
+    std::string entryName;
+    size_t size = 0;
+    auto buffer = pksm::utils::ZipReader::SplitEntryPath(path, archivePath, entryName)
+        ? ReadArchiveEntry(archivePath, entryName, size)
+        : ReadFile(path, size);
+    stats.read = ElapsedSince(start);
+    stats.bytes = size;
+    if (!buffer) {
+        return nullptr;
+    }
+
+    const auto parseStart = std::chrono::steady_clock::now();
+    std::unique_ptr<pksm::Sav> sav;
+    try {
+        TRACE_SCOPE("Sav::getSave");
+        sav = pksm::Sav::getSave(buffer, size);
+    } catch (const std::exception& e) {
+        LOG_ERROR("PKSM-Core failed to parse save: " + std::string(e.what()));
+        LOG_ERROR("This save file may be corrupted, incompatible, or from an unsupported game.");
+        return nullptr;
+    }
+    stats.parse = ElapsedSince(parseStart);
+    stats.total = ElapsedSince(start);
+
+    if (!sav) {
+        LOG_ERROR("PKSM-Core could not detect a valid save type");
+        return nullptr;
+    }
+
+    LOG_DEBUGF(
+        "Save load timing: {} bytes, read {}us ({} MB/s), parse {}us, first Sav after {}us",
+        size,
+        stats.read.count(),
+        static_cast<int>(stats.ReadThroughput()),
+        stats.parse.count(),
+        stats.total.count()
+    );
+    return sav;
+}
+
+std::shared_ptr<u8[]> SaveReader::ReadArchiveEntry(
+    const std::string& archivePath,
+    const std::string& entryName,
+    size_t& size
+) {
+    pksm::utils::ZipReader zip;
+    const pksm::utils::ZipReader::Entry* entry = zip.Open(archivePath) ? zip.Find(entryName) : nullptr;
+    if (!entry || entry->uncompressedSize == 0) {
+        LOG_ERROR("Save file does not exist: " + archivePath + " (" + entryName + ")");
+        return nullptr;
+    }
+    size = static_cast<size_t>(entry->uncompressedSize);
+
+    auto buffer = AllocateSaveBuffer(size);
+    if (!buffer) {
+        return nullptr;
+    }
+
+    if (!zip.Extract(*entry, buffer.get())) {
+        LOG_ERROR("Failed to read save file: " + archivePath + " (" + entryName + ")");
+        return nullptr;
+    }
+    return buffer;
+}
+
+}  // namespace pksm::saves
@@ -0,0 +1,231 @@
+#include "data/saves/SaveWriter.hpp"
+
+#include <cstdio>
+#include <ctime>
+#include <filesystem>
+#include <sys/stat.h>
+#include <unistd.h>
+
+#include "pksmcore/sav/Sav.hpp"
+#include "utils/Logger.hpp"
+#include "utils/ZipReader.hpp"
+
+namespace pksm::saves {
+
+namespace {
+
+std::chrono::microseconds ElapsedSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start);
+}
+
+}  // namespace
+
+SaveWriter::SaveWriter(ISaveMounter::Ref mounter, std::string backupRoot)
+  : mounter(std::move(mounter)), backupRoot(std::move(backupRoot)) {}
+
+std::string SaveWriter::ResolveSavePath(const std::string& saveName) {
+    return (saveName.find(":/") == std::string::npos) ? (SAVE_DEVICE_PREFIX + saveName) : saveName;
+}
+
+bool SaveWriter::IsSaveDevicePath(const std::string& savePath) {
+    return savePath.rfind(SAVE_DEVICE_PREFIX, 0) == 0;
+}
+
+bool SaveWriter::Write(
+    pksm::Sav& sav,
+    u64 titleId,
+    const std::string& filePath,
+    Destination destination,
+    Timing* timing
+) {
+    const auto start = std::chrono::steady_clock::now();
+    sav.finishEditing();
+    const auto finishEditing = ElapsedSince(start);
+
+    const bool written = WriteData(sav.rawData().get(), sav.getLength(), titleId, filePath, destination, timing);
+
+    // finishEditing leaves the save encrypted, so it has to be opened again for further edits
+    sav.beginEditing();
+
+    if (timing) {
+        timing->finishEditing = finishEditing;
+        timing->total = ElapsedSince(start);
+    }
+    return written;
+}
+
+bool SaveWriter::WriteData(
+    const u8* data,
+    size_t size,
+    u64 titleId,
+    const std::string& filePath,
+    Destination destination,
+    Timing* timing
+) {
+    Timing localTiming;
+    Timing& stats = timing ? *timing : localTiming;
+    stats = Timing{};
+    stats.bytes = size;
+    const auto start = std::chrono::steady_clock::now();
+
+    std::string archivePath;
+    std::string entryName;
+    if (pksm::utils::ZipReader::SplitEntryPath(filePath, archivePath, entryName)) {
+        LOG_ERROR("Saves inside zipped backups can't be written: " + filePath);
+        return false;
+    }
+
+    const bool inMountedSave = destination == Destination::MountedSave;
+    auto phaseStart = std::chrono::steady_clock::now();
+    bool written = BackupFile(filePath, titleId);
+    stats.backup = ElapsedSince(phaseStart);
+
+    if (written) {
+        // A console save has a fixed size, so there may be no room for a temporary copy of the file.
+        // The commit below makes overwriting it atomic anyway.
+        phaseStart = std::chrono::steady_clock::now();
+        written = inMountedSave ? WriteFileInPlace(filePath, data, size) : WriteFileAtomically(filePath, data, size);
+        stats.write = ElapsedSince(phaseStart);
+    }
+
+    if (inMountedSave && written) {
+        phaseStart = std::chrono::steady_clock::now();
+        written = mounter->Commit();
+        stats.commit = ElapsedSince(phaseStart);
+    }
+
+    stats.total = ElapsedSince(start);
+    if (written) {
+        LOG_DEBUGF(
+            "Save write timing: {} bytes, backup {}us, write {}us, commit {}us",
+            size,
+            stats.backup.count(),
+            stats.write.count(),
+            stats.commit.count()
+        );
+    }
+    return written;
+}
+
+bool SaveWriter::WriteFileAtomically(const std::string& path, const u8* data, size_t size) {
+    const std::string tempPath = path + TEMP_SUFFIX;
+    const std::string previousPath = path + PREVIOUS_SUFFIX;
+
+    FILE* file = std::fopen(tempPath.c_str(), "wb");
+    if (!file) {
+        LOG_ERROR("Failed to create temporary save file: " + tempPath);
+        return false;
+    }
+
+    // The whole save goes out in one write, so stdio buffering would only add a copy
+    std::setvbuf(file, nullptr, _IONBF, 0);
+    bool written = std::fwrite(data, 1, size, file) == size;
+    written = (std::fflush(file) == 0) && written;
+    written = (fsync(fileno(file)) == 0) && written;
+    written = (std::fclose(file) == 0) && written;
+    if (!written) {
+        LOG_ERROR("Failed to write temporary save file: " + tempPath);
+        std::remove(tempPath.c_str());
+        return false;
+    }
+
+    // The Switch file system doesn't rename over existing files, so the original is moved aside
+    // first. At every step either path or the complete temporary file exists.
+    std::error_code ec;
+    const bool hadFile = std::filesystem::exists(path, ec);
+    if (hadFile) {
+        std::remove(previousPath.c_str());
+        if (std::rename(path.c_str(), previousPath.c_str()) != 0) {
+            LOG_ERROR("Failed to move aside save file: " + path);
+            std::remove(tempPath.c_str());
+            return false;
+        }
+    }
+    if (std::rename(tempPath.c_str(), path.c_str()) != 0) {
+        LOG_ERROR("Failed to replace save file: " + path);
+        if (hadFile) {
+            std::rename(previousPath.c_str(), path.c_str());
+        }
+        std::remove(tempPath.c_str());
+        return false;
+    }
+    if (hadFile) {
+        std::remove(previousPath.c_str());
+    }
+    return true;
+}
+
+bool SaveWriter::RecoverInterruptedWrite(const std::string& path) {
+    std::error_code ec;
+    if (std::filesystem::exists(path, ec)) {
+        return true;
+    }
+
+    // The temporary file is only renamed once it is fully written and flushed, so if the original
+    // has already been moved aside it is complete and newer than the previous file
+    for (const char* suffix : {TEMP_SUFFIX, PREVIOUS_SUFFIX}) {
+        const std::string candidate = path + suffix;
+        if (std::filesystem::exists(candidate, ec) && std::rename(candidate.c_str(), path.c_str()) == 0) {
+            LOG_WARNING("Recovered save file from an interrupted write: " + candidate);
+            return true;
+        }
+    }
+    return false;
+}
+
+bool SaveWriter::WriteFileInPlace(const std::string& path, const u8* data, size_t size) {
+    // Overwrite the existing blocks rather than truncating the file and allocating new ones
+    FILE* file = std::fopen(path.c_str(), "r+b");
+    if (!file) {
+        file = std::fopen(path.c_str(), "wb");
+    }
+    if (!file) {
+        LOG_ERROR("Failed to open save file for writing: " + path);
+        return false;
+    }
+
+    std::setvbuf(file, nullptr, _IONBF, 0);
+    bool written = std::fwrite(data, 1, size, file) == size;
+    written = (std::fflush(file) == 0) && written;
+
+    // Drop whatever is left past the end if the file was longer
+    struct stat fileStat;
+    if (written && fstat(fileno(file), &fileStat) == 0 && static_cast<size_t>(fileStat.st_size) > size) {
+        written = ftruncate(fileno(file), static_cast<off_t>(size)) == 0;
+    }
+    written = (std::fclose(file) == 0) && written;
+    if (!written) {
+        LOG_ERROR("Failed to write save file: " + path);
+    }
+    return written;
+}
+
+bool SaveWriter::BackupFile(const std::string& path, u64 titleId) const {
+    std::error_code ec;
+    if (backupRoot.empty() || !std::filesystem::exists(path, ec)) {
+        return true;
+    }
+
+    char titleIdStr[17];
+    std::snprintf(titleIdStr, sizeof(titleIdStr), "%016llx", static_cast<unsigned long long>(titleId));
+    char timeStr[32];
+    const std::time_t now = std::time(nullptr);
+    std::strftime(timeStr, sizeof(timeStr), "%Y%m%d-%H%M%S", std::localtime(&now));
+
+    const std::filesystem::path backupDir = std::filesystem::path(backupRoot) / titleIdStr / timeStr;
+    std::filesystem::create_directories(backupDir, ec);
+    if (ec) {
+        LOG_ERROR("Failed to create save backup directory " + backupDir.string() + ": " + ec.message());
+        return false;
+    }
+
+    const std::filesystem::path backupPath = backupDir / std::filesystem::path(path).filename();
+    std::filesystem::copy_file(path, backupPath, std::filesystem::copy_options::overwrite_existing, ec);
+    if (ec) {
+        LOG_ERROR("Failed to back up save to " + backupPath.string() + ": " + ec.message());
+        return false;
+    }
+    return true;
+}
+
+}  // namespace pksm::saves
@@ -0,0 +1,150 @@
+#include "data/titles/TitleCatalogue.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <fstream>
+#include <iterator>
+#include <mutex>
+#include <nlohmann/json.hpp>
+
+#include "pksmcore/utils/endian.hpp"
+#include "utils/Logger.hpp"
+
+namespace pksm::titles {
+
+TitleCatalogue::Ref TitleCatalogue::Get() {
+    static std::once_flag loaded;
+    static Ref catalogue;
+
+    std::call_once(loaded, []() {
+        const auto start = std::chrono::steady_clock::now();
+
+        auto newCatalogue = std::make_shared<TitleCatalogue>();
+        const bool fromBinary = newCatalogue->LoadBinary(CATALOGUE_PATH);
+        if (!fromBinary && !newCatalogue->LoadJson(JSON_PATH)) {
+            LOG_ERROR("Failed to load the title catalogue, no titles will be listed");
+        }
+        catalogue = std::move(newCatalogue);
+
+        LOG_DEBUG(
+            "Startup timing: title catalogue " +
+            std::to_string(
+                std::chrono::duration_cast<std::chrono::microseconds>(std::chrono::steady_clock::now() - start).count()
+            ) +
+            "us, " + std::to_string(catalogue->entries.size()) + " titles from " +
+            (fromBinary ? CATALOGUE_PATH : JSON_PATH)
+        );
+    });
+
+    return catalogue;
+}
+
+const TitleCatalogue::Entry* TitleCatalogue::Find(u64 titleId) const {
+    auto entryIt = std::find_if(entries.begin(), entries.end(), [titleId](const Entry& entry) {
+        return entry.title->getTitleId() == titleId;
+    });
+    return (entryIt != entries.end()) ? &*entryIt : nullptr;
+}
+
+bool TitleCatalogue::LoadBinary(const std::string& path) {
+    // Catalogue layout, little endian:
+    //   "PKTC" magic, u16 version, u16 entry count
+    //   per entry: u64 title id, then name, icon path and main save file, each a u16 length and UTF-8 bytes
+    static constexpr char MAGIC[4] = {'P', 'K', 'T', 'C'};
+    static constexpr u16 VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 8;
+
+    std::ifstream file(path, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_DEBUG("No precompiled title catalogue at " + path);
+        return false;
+    }
+
+    std::vector<u8> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    if (data.size() < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), data.begin()) ||
+        LittleEndian::convertTo<u16>(data.data() + 4) != VERSION) {
+        LOG_ERROR("Invalid or unsupported title catalogue: " + path);
+        return false;
+    }
+
+    const u16 entryCount = LittleEndian::convertTo<u16>(data.data() + 6);
+    size_t offset = HEADER_SIZE;
+    auto readString = [&data, &offset](std::string& out) {
+        if (offset + 2 > data.size()) {
+            return false;
+        }
+        const u16 length = LittleEndian::convertTo<u16>(data.data() + offset);
+        offset += 2;
+        if (offset + length > data.size()) {
+            return false;
+        }
+        out.assign(reinterpret_cast<const char*>(data.data() + offset), length);
+        offset += length;
+        return true;
+    };
+
+    std::vector<Entry> loaded;
+    loaded.reserve(entryCount);
+    for (u16 i = 0; i < entryCount; i++) {
+        if (offset + 8 > data.size()) {
+            LOG_ERROR("Truncated title catalogue: " + path);
+            return false;
+        }
+        const u64 titleId = LittleEndian::convertTo<u64>(data.data() + offset);
+        offset += 8;
+
+        std::string name, iconPath, mainSaveFile;
+        if (!readString(name) || !readString(iconPath) || !readString(mainSaveFile)) {
+            LOG_ERROR("Truncated title catalogue: " + path);
+            return false;
+        }
+        loaded.push_back({Title::New(name, iconPath, titleId), std::move(mainSaveFile)});
+    }
+
+    entries = std::move(loaded);
+    return true;
+}
+
+bool TitleCatalogue::LoadJson(const std::string& path) {
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open titles JSON file: " + path);
+        return false;
+    }
+
+    try {
+        // Most of data.json is Pokemon sprite metadata, so only build the "games" part of the tree
+        const auto keepGames = [](int depth, nlohmann::json::parse_event_t event, nlohmann::json& parsed) {
+            return !(depth == 1 && event == nlohmann::json::parse_event_t::key && parsed != "games");
+        };
+        const nlohmann::json j = nlohmann::json::parse(file, keepGames);
+
+        for (const auto& game : j.at("games")) {
+            if (game.value("category", "") != "console") {
+                continue;
+            }
+
+            u64 titleId = 0;
+            try {
+                titleId = std::stoull(game.at("title_id").get<std::string>(), nullptr, 16);
+            } catch (...) {
+                continue;
+            }
+
+            entries.push_back(
+                {Title::New(game.at("name").get<std::string>(), game.at("icon_path").get<std::string>(), titleId),
+                 game.value("main_save_file", "")}
+            );
+        }
+    } catch (const std::exception& e) {
+        LOG_ERROR("Error loading titles: " + std::string(e.what()));
+        entries.clear();
+        return false;
+    }
+
+    return true;
+}
+
+}  // namespace pksm::titles
@@ -0,0 +1,63 @@
+#include "data/titles/TitleIconLoader.hpp"
+
+#include <algorithm>
+
+#include "utils/Logger.hpp"
+
+namespace pksm::titles {
+
+std::vector<TitleIconLoader::Icon> TitleIconLoader::icons;
+utils::SpriteDecoder TitleIconLoader::decoder;
+
+pu::sdl2::TextureHandle::Ref TitleIconLoader::GetIcon(const std::string& iconPath) {
+    // There are only a handful of titles, so a linear search is fine
+    auto iconIt = std::find_if(icons.begin(), icons.end(), [&iconPath](const Icon& icon) {
+        return icon.path == iconPath;
+    });
+    if (iconIt == icons.end()) {
+        iconIt = icons.insert(icons.end(), Icon{iconPath, {}});
+    }
+
+    if (auto texture = iconIt->texture.lock()) {
+        return texture;
+    }
+
+    // The decoder ignores ids that are already queued, so an icon freed while its decode is still
+    // running just gets the result delivered to the new handle
+    auto texture = pu::sdl2::TextureHandle::New();
+    iconIt->texture = texture;
+    decoder.Start();
+    decoder.Queue(static_cast<u32>(iconIt - icons.begin()), iconPath, true);
+    return texture;
+}
+
+void TitleIconLoader::ProcessDecodedIcons() {
+    utils::SpriteDecoder::DecodedImage image;
+    while (decoder.TakeDecoded(image)) {
+        auto texture = (image.id < icons.size()) ? icons[image.id].texture.lock() : nullptr;
+        if (!texture) {
+            // Nothing shows the icon anymore
+            if (image.surface) {
+                SDL_FreeSurface(image.surface);
+            }
+            continue;
+        }
+
+        // ConvertToTexture takes ownership of the surface
+        SDL_Texture* iconTexture = pu::ui::render::ConvertToTexture(image.surface);
+        if (!iconTexture) {
+            LOG_ERROR("Failed to load title icon: " + image.path);
+            continue;
+        }
+
+        texture->Reset(iconTexture);
+        pu::ui::RequestRedraw();
+    }
+}
+
+void TitleIconLoader::Cleanup() {
+    decoder.Stop();
+    icons.clear();
+}
+
+}  // namespace pksm::titles
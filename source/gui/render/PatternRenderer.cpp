@@ -1,13 +1,31 @@
 #include "gui/render/PatternRenderer.hpp"
 
+#include <algorithm>
 #include <pu/ui/render/render_Renderer.hpp>
 #include <sstream>
+#include <tuple>
+#include <vector>
 
 #include "utils/Logger.hpp"
 #include "utils/SDLHelper.hpp"
 
 namespace pksm::ui::render {
 
+std::map<PatternRenderer::PatternKey, std::weak_ptr<pu::sdl2::TextureHandle>> PatternRenderer::patternCache;
+
+bool PatternRenderer::PatternKey::operator<(const PatternKey& other) const {
+    return std::tie(width, height, cornerRadius, lineSpacing, lineThickness, lineColor, backgroundColor) <
+        std::tie(
+               other.width,
+               other.height,
+               other.cornerRadius,
+               other.lineSpacing,
+               other.lineThickness,
+               other.lineColor,
+               other.backgroundColor
+        );
+}
+
 bool PatternRenderer::IsInRoundedCorner(
     const pu::i32 x,
     const pu::i32 y,
@@ -57,13 +75,6 @@ PatternBackground::PatternBackground(
     CreateBackgroundTexture();
 }
 
-PatternBackground::~PatternBackground() {
-    if (backgroundTexture) {
-        SDL_DestroyTexture(backgroundTexture);
-        backgroundTexture = nullptr;
-    }
-}
-
 void PatternBackground::SetDimensions(const pu::i32 width, const pu::i32 height) {
     if (this->width != width || this->height != height) {
         this->width = width;
@@ -104,209 +115,173 @@ void PatternBackground::SetLineProperties(const pu::i32 spacing, const pu::i32 t
 }
 
 void PatternBackground::CreateBackgroundTexture() {
-    // Clean up existing texture
-    if (backgroundTexture) {
-        SDL_DestroyTexture(backgroundTexture);
-        backgroundTexture = nullptr;
-    }
-
-    // Create new texture using our existing pattern generation code
-    backgroundTexture =
-        PatternRenderer::CreateDiagonalLinePattern(width, height, cornerRadius, lineSpacing, lineThickness, lineColor);
+    backgroundTexture = PatternRenderer::GetDiagonalLinePattern(
+        width,
+        height,
+        cornerRadius,
+        lineSpacing,
+        lineThickness,
+        lineColor,
+        backgroundColor
+    );
+    MarkDirty();
 }
 
 void PatternBackground::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu::i32 x, const pu::i32 y) {
-    // Draw solid background first
-    drawer->RenderRoundedRectangleFill(backgroundColor, x, y, width, height, cornerRadius);
-
-    // Draw pattern overlay
+    // The background colour is part of the pattern texture
     if (backgroundTexture) {
-        SDL_Rect destRect = {x, y, width, height};
-        SDL_RenderCopy(pu::ui::render::GetMainRenderer(), backgroundTexture, nullptr, &destRect);
+        drawer->RenderTexture(backgroundTexture->Get(), x, y);
     }
 }
 
-SDL_Texture* PatternRenderer::CreateDiagonalLinePattern(
+pu::sdl2::TextureHandle::Ref PatternRenderer::GetDiagonalLinePattern(
     const pu::i32 width,
     const pu::i32 height,
     const pu::i32 cornerRadius,
     const pu::i32 lineSpacing,
     const pu::i32 lineThickness,
-    const pu::ui::Color& lineColor
+    const pu::ui::Color& lineColor,
+    const pu::ui::Color& backgroundColor
 ) {
-    LOG_DEBUG("Starting CreateDiagonalLinePattern");
+    const PatternKey key =
+        {width, height, cornerRadius, lineSpacing, lineThickness, PackPixel(lineColor), PackPixel(backgroundColor)};
 
-    // Safety check
-    if (width <= 0 || height <= 0) {
-        LOG_ERROR("Invalid dimensions for pattern texture");
-        return nullptr;
+    auto it = patternCache.find(key);
+    if (it != patternCache.end()) {
+        if (auto texture = it->second.lock()) {
+            return texture;
+        }
     }
 
-    // Create a smaller repeating pattern texture (128x128)
-    const pu::i32 patternSize = 128;
-    SDL_Texture* patternTexture = SDL_CreateTexture(
-        pu::ui::render::GetMainRenderer(),
-        SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
-        patternSize,
-        patternSize
-    );
-
-    if (!patternTexture) {
-        LOG_ERROR("Failed to create pattern texture");
+    SDL_Texture* texture = CreateDiagonalLinePattern(key);
+    if (!texture) {
         return nullptr;
     }
-    LOG_DEBUG("Pattern texture created successfully");
 
-    // Set up the pattern texture
-    if (SDL_SetTextureBlendMode(patternTexture, pksm::sdl::BlendModeBlend()) < 0) {
-        LOG_ERROR("Failed to set pattern texture blend mode");
-        SDL_DestroyTexture(patternTexture);
-        return nullptr;
-    }
+    auto handle = pu::sdl2::TextureHandle::New(texture);
+    patternCache[key] = handle;
+    return handle;
+}
 
-    // Draw the repeating pattern
-    if (SDL_SetRenderTarget(pu::ui::render::GetMainRenderer(), patternTexture) < 0) {
-        LOG_ERROR("Failed to set render target for pattern: " + std::string(SDL_GetError()));
-        SDL_DestroyTexture(patternTexture);
-        return nullptr;
-    }
+u32 PatternRenderer::PackPixel(const pu::ui::Color& color) {
+    return (static_cast<u32>(color.r) << 24) | (static_cast<u32>(color.g) << 16) | (static_cast<u32>(color.b) << 8) |
+        static_cast<u32>(color.a);
+}
 
-    // Clear pattern texture
-    SDL_SetRenderDrawColor(pu::ui::render::GetMainRenderer(), 0, 0, 0, 0);
-    SDL_RenderClear(pu::ui::render::GetMainRenderer());
+SDL_Texture* PatternRenderer::CreateDiagonalLinePattern(const PatternKey& key) {
+    LOG_DEBUG("Starting CreateDiagonalLinePattern");
 
-    // Draw diagonal lines in the pattern
-    // Calculate exact number of lines needed for seamless tiling
-    const pu::i32 numLines = (patternSize * 2) / lineSpacing + 1;
-    const pu::i32 startX = -(patternSize + lineThickness);
+    const pu::i32 width = key.width;
+    const pu::i32 height = key.height;
+    const pu::i32 cornerRadius = key.cornerRadius;
+    const pu::i32 lineSpacing = key.lineSpacing;
+    const pu::i32 lineThickness = key.lineThickness;
 
-    for (pu::i32 i = 0; i < numLines; i++) {
-        pu::i32 lineStart = startX + (i * lineSpacing);
+    // Safety check
+    if (width <= 0 || height <= 0 || lineSpacing <= 0) {
+        LOG_ERROR("Invalid dimensions for pattern texture");
+        return nullptr;
+    }
 
-        // Draw each diagonal line
-        for (pu::i32 y = -lineThickness; y < patternSize + lineThickness; y++) {
-            pu::i32 x = lineStart + y;
+    // Lines are drawn over the background, so blend the two colours once up front like SDL would per pixel
+    const u32 backgroundPixel = key.backgroundColor;
+    const float lineA = static_cast<float>(key.lineColor & 0xFF) / 255.0f;
+    const float backgroundA = static_cast<float>(backgroundPixel & 0xFF) / 255.0f;
+    const float outA = lineA + backgroundA * (1.0f - lineA);
+    u32 linePixel = 0;
+    if (outA > 0.0f) {
+        for (int shift : {24, 16, 8}) {
+            const float lineC = static_cast<float>((key.lineColor >> shift) & 0xFF);
+            const float backgroundC = static_cast<float>((backgroundPixel >> shift) & 0xFF);
+            const float outC = (lineC * lineA + backgroundC * backgroundA * (1.0f - lineA)) / outA;
+            linePixel |= static_cast<u32>(std::clamp(outC + 0.5f, 0.0f, 255.0f)) << shift;
+        }
+        linePixel |= static_cast<u32>(outA * 255.0f + 0.5f);
+    }
 
-            // Draw line thickness
+    // Build one row of the repeating tile per tile row, marking the pixels each diagonal line covers. Lines start
+    // left of the tile and wrap around so the tile repeats seamlessly.
+    const pu::i32 numLines = (PATTERN_SIZE * 2) / lineSpacing + 1;
+    const pu::i32 startX = -(PATTERN_SIZE + lineThickness);
+    std::vector<u32> tileRows(PATTERN_SIZE * PATTERN_SIZE, backgroundPixel);
+    for (pu::i32 y = 0; y < PATTERN_SIZE; y++) {
+        u32* row = tileRows.data() + (y * PATTERN_SIZE);
+        for (pu::i32 i = 0; i < numLines; i++) {
+            const pu::i32 x = startX + (i * lineSpacing) + y;
             for (pu::i32 t = 0; t < lineThickness; t++) {
-                pu::i32 xt = x + t;
-                // Wrap around for seamless tiling
-                while (xt < 0)
-                    xt += patternSize;
-                xt %= patternSize;
-
-                if (y >= 0 && y < patternSize) {
-                    SDL_SetRenderDrawColor(
-                        pu::ui::render::GetMainRenderer(),
-                        lineColor.r,
-                        lineColor.g,
-                        lineColor.b,
-                        lineColor.a
-                    );
-                    SDL_RenderDrawPoint(pu::ui::render::GetMainRenderer(), xt, y);
+                pu::i32 xt = (x + t) % PATTERN_SIZE;
+                if (xt < 0) {
+                    xt += PATTERN_SIZE;
                 }
+                row[xt] = linePixel;
             }
         }
     }
 
-    // Create the final texture with corner masking
-    SDL_Texture* finalTexture = SDL_CreateTexture(
+    // Tile the pattern across the texture a row span at a time
+    std::vector<u32> pixels(static_cast<size_t>(width) * height);
+    for (pu::i32 y = 0; y < height; y++) {
+        const u32* tileRow = tileRows.data() + ((y % PATTERN_SIZE) * PATTERN_SIZE);
+        u32* row = pixels.data() + (static_cast<size_t>(y) * width);
+        for (pu::i32 x = 0; x < width; x += PATTERN_SIZE) {
+            std::copy_n(tileRow, std::min(PATTERN_SIZE, width - x), row + x);
+        }
+    }
+
+    // Clear the pixels outside the rounded corners. Within a corner row the cleared pixels always form a span from
+    // the outer edge inwards.
+    for (pu::i32 y = 0; y < height; y++) {
+        const bool topRow = y < cornerRadius;
+        const bool bottomRow = y > height - cornerRadius;
+        if (!topRow && !bottomRow) {
+            continue;
+        }
+        const pu::i32 cornerY = topRow ? cornerRadius : height - cornerRadius;
+        u32* row = pixels.data() + (static_cast<size_t>(y) * width);
+
+        // Left corner
+        pu::i32 leftEnd = 0;
+        while (leftEnd < std::min(cornerRadius, width) &&
+               !IsInRoundedCorner(leftEnd, y, cornerRadius, cornerY, cornerRadius)) {
+            leftEnd++;
+        }
+        std::fill(row, row + leftEnd, 0);
+
+        // Right corner
+        pu::i32 rightStart = width;
+        while (rightStart - 1 > std::max(width - cornerRadius, 0) &&
+               !IsInRoundedCorner(rightStart - 1, y, width - cornerRadius, cornerY, cornerRadius)) {
+            rightStart--;
+        }
+        std::fill(row + rightStart, row + width, 0);
+    }
+
+    SDL_Texture* texture = SDL_CreateTexture(
         pu::ui::render::GetMainRenderer(),
         SDL_PIXELFORMAT_RGBA8888,
-        SDL_TEXTUREACCESS_TARGET,
+        SDL_TEXTUREACCESS_STATIC,
         width,
         height
     );
-
-    if (!finalTexture) {
-        LOG_ERROR("Failed to create final texture");
-        SDL_DestroyTexture(patternTexture);
+    if (!texture) {
+        LOG_ERROR("Failed to create pattern texture: " + std::string(SDL_GetError()));
         return nullptr;
     }
 
-    // Set up the final texture
-    if (SDL_SetTextureBlendMode(finalTexture, pksm::sdl::BlendModeBlend()) < 0) {
-        LOG_ERROR("Failed to set final texture blend mode");
-        SDL_DestroyTexture(patternTexture);
-        SDL_DestroyTexture(finalTexture);
+    if (SDL_UpdateTexture(texture, nullptr, pixels.data(), width * static_cast<int>(sizeof(u32))) < 0) {
+        LOG_ERROR("Failed to upload pattern texture: " + std::string(SDL_GetError()));
+        SDL_DestroyTexture(texture);
         return nullptr;
     }
 
-    // Set render target to final texture
-    if (SDL_SetRenderTarget(pu::ui::render::GetMainRenderer(), finalTexture) < 0) {
-        LOG_ERROR("Failed to set render target for final texture: " + std::string(SDL_GetError()));
-        SDL_DestroyTexture(patternTexture);
-        SDL_DestroyTexture(finalTexture);
-        return nullptr;
-    }
-
-    // Clear final texture
-    SDL_SetRenderDrawColor(pu::ui::render::GetMainRenderer(), 0, 0, 0, 0);
-    SDL_RenderClear(pu::ui::render::GetMainRenderer());
-
-    // Tile the pattern texture across the final texture
-    for (pu::i32 y = 0; y < height; y += patternSize) {
-        for (pu::i32 x = 0; x < width; x += patternSize) {
-            SDL_Rect destRect = {x, y, patternSize, patternSize};
-            SDL_RenderCopy(pu::ui::render::GetMainRenderer(), patternTexture, nullptr, &destRect);
-        }
-    }
-
-    // Apply corner radius masking - using existing logic
-    SDL_SetRenderDrawBlendMode(pu::ui::render::GetMainRenderer(), pksm::sdl::BlendModeNone());
-    for (pu::i32 y = 0; y < height; y++) {
-        for (pu::i32 x = 0; x < width; x++) {
-            bool shouldMask = false;
-
-            if (y < cornerRadius) {
-                // Top-left corner
-                if (x < cornerRadius) {
-                    if (!IsInRoundedCorner(x, y, cornerRadius, cornerRadius, cornerRadius)) {
-                        shouldMask = true;
-                    }
-                }
-                // Top-right corner
-                if (x > width - cornerRadius) {
-                    if (!IsInRoundedCorner(x, y, width - cornerRadius, cornerRadius, cornerRadius)) {
-                        shouldMask = true;
-                    }
-                }
-            }
-            if (y > height - cornerRadius) {
-                // Bottom-left corner
-                if (x < cornerRadius) {
-                    if (!IsInRoundedCorner(x, y, cornerRadius, height - cornerRadius, cornerRadius)) {
-                        shouldMask = true;
-                    }
-                }
-                // Bottom-right corner
-                if (x > width - cornerRadius) {
-                    if (!IsInRoundedCorner(x, y, width - cornerRadius, height - cornerRadius, cornerRadius)) {
-                        shouldMask = true;
-                    }
-                }
-            }
-
-            if (shouldMask) {
-                SDL_SetRenderDrawColor(pu::ui::render::GetMainRenderer(), 0, 0, 0, 0);
-                SDL_RenderDrawPoint(pu::ui::render::GetMainRenderer(), x, y);
-            }
-        }
-    }
-
-    // Reset render target
-    if (SDL_SetRenderTarget(pu::ui::render::GetMainRenderer(), NULL) < 0) {
-        LOG_ERROR("Failed to reset render target: " + std::string(SDL_GetError()));
-        SDL_DestroyTexture(finalTexture);
+    if (SDL_SetTextureBlendMode(texture, pksm::sdl::BlendModeBlend()) < 0) {
+        LOG_ERROR("Failed to set pattern texture blend mode");
+        SDL_DestroyTexture(texture);
         return nullptr;
     }
 
-    // Clean up pattern texture
-    SDL_DestroyTexture(patternTexture);
-
     LOG_DEBUG("Pattern texture creation complete");
-    return finalTexture;
+    return texture;
 }
 
 }  // namespace pksm::ui::render
\ No newline at end of file
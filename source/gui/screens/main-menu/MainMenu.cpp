@@ -36,7 +36,16 @@ MainMenu::MainMenu(
         0.0f,  // Completion (will be updated)
         ""  // Time played (will be updated)
     );
-    this->Add(trainerInfo);
+
+    // Trainer info only changes with the save, so draw it from a cached texture
+    trainerInfoCache = pu::ui::elm::CachedContainer::New(
+        TRAINER_INFO_SIDE_MARGIN,
+        TRAINER_INFO_TOP_MARGIN,
+        TRAINER_INFO_WIDTH,
+        trainerInfo->GetHeight()
+    );
+    trainerInfoCache->Add(trainerInfo);
+    this->Add(trainerInfoCache);
 
     // Calculate MenuButtonGrid width and position
     const pu::i32 MENU_GRID_MARGIN = 32;  // Margin between TrainerInfo and MenuButtonGrid
@@ -64,7 +73,6 @@ MainMenu::MainMenu(
     
     versionBackground->SetWidth(VERSION_IMAGE_WIDTH);
     versionBackground->SetHeight(VERSION_IMAGE_HEIGHT);
-    this->Add(versionBackground);
     
     versionText = pu::ui::elm::TextBlock::New(
         GetWidth() - VERSION_IMAGE_WIDTH + VERSION_IMAGE_PADDING,
@@ -74,7 +82,16 @@ MainMenu::MainMenu(
 
     versionText->SetColor(pu::ui::Color(255, 255, 255, 255));
     versionText->SetFont(pksm::ui::global::MakeHeavyFontName(35));
-    this->Add(versionText);
+
+    versionCache = pu::ui::elm::CachedContainer::New(
+        versionBackground->GetX(),
+        versionBackground->GetY(),
+        VERSION_IMAGE_WIDTH,
+        VERSION_IMAGE_HEIGHT
+    );
+    versionCache->Add(versionBackground);
+    versionCache->Add(versionText);
+    this->Add(versionCache);
 
     // Register navigation callbacks for the menu buttons
     RegisterNavigationCallbacks();
@@ -144,6 +161,9 @@ void MainMenu::UpdateTrainerInfo() {
         // Set default values
         trainerInfo->SetTrainerInfo("No Save Loaded", 0, 0, 0, 0, 0.0f, "00:00:00", pksm::saves::Generation::TWO);
     }
+
+    // The panel's height depends on its contents
+    trainerInfoCache->SetHeight(trainerInfo->GetHeight());
 }
 
 MainMenu::~MainMenu() = default;
@@ -347,6 +347,7 @@ void TrainerInfo::SetTrainerInfo(
     trainerValue->SetText(otName);  // Update trainer name value
     UpdateTexts();
     LayoutElements();
+    MarkDirty();
 }
 
 }  // namespace pksm::ui
\ No newline at end of file
@@ -1,4 +1,5 @@
 #include "gui/screens/settings-screen/SettingsScreen.hpp"
+#include "gui/shared/GuiSettings.hpp"
 #include "gui/shared/UIConstants.hpp"
 #include "utils/Logger.hpp"
 
@@ -67,6 +68,22 @@ SettingsScreen::SettingsScreen(
     );
     currentY += BUTTON_HEIGHT + BUTTON_SPACING;
 
+    CreateSettingButton(
+        "Background Animation",
+        ui::AnimatedBackground::IsAnimationPaused() ? "Off" : "On",
+        currentY,
+        [this]() {
+            const bool paused = !ui::AnimatedBackground::IsAnimationPaused();
+            ui::AnimatedBackground::SetAnimationPaused(paused);
+            ui::GuiSettings settings = ui::GuiSettings::Load();
+            settings.backgroundAnimationPaused = paused;
+            settings.Save();
+            backgroundAnimationButton->SetContent(std::string("Background Animation: ") + (paused ? "Off" : "On"));
+        }
+    );
+    backgroundAnimationButton = settingButtons.back();
+    currentY += BUTTON_HEIGHT + BUTTON_SPACING;
+
     CreateSettingButton(
         "Animation Speed",
         "Normal",
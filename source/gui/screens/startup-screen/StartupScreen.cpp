@@ -117,6 +117,7 @@ void StartupScreen::OnInput(u64 down, u64 up, u64 held) {
 void StartupScreen::UpdateLoadingAnimation() {
     if (completed) return;
 
+    pu::ui::RequestRedraw();
     auto currentTime = std::chrono::steady_clock::now();
     auto elapsed = std::chrono::duration_cast<std::chrono::milliseconds>(currentTime - startTime).count();
     
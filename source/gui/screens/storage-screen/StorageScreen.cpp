@@ -4,6 +4,7 @@
 
 #include "gui/screens/main-menu/sub-components/menu-grid/MenuButtonGrid.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 namespace pksm::layout {
 
@@ -193,10 +194,10 @@ void StorageScreen::InitializePokemonBoxes() {
     LoadBoxData();
 
     pokemonBankBox->SetOnSelectionChanged([this](int boxIndex, int slotIndex) {
-        LOG_DEBUG("Bank box selection changed: Box " + std::to_string(boxIndex) + ", Slot " + std::to_string(slotIndex));
+        LOG_DEBUGF("Bank box selection changed: Box {}, Slot {}", boxIndex, slotIndex);
     });
     pokemonSaveBox->SetOnSelectionChanged([this](int boxIndex, int slotIndex) {
-        LOG_DEBUG("Save box selection changed: Box " + std::to_string(boxIndex) + ", Slot " + std::to_string(slotIndex));
+        LOG_DEBUGF("Save box selection changed: Box {}, Slot {}", boxIndex, slotIndex);
     });
 
     SetActiveBox(ActiveBox::Save);
@@ -205,6 +206,7 @@ void StorageScreen::InitializePokemonBoxes() {
 }
 
 void StorageScreen::LoadBoxData() {
+    TRACE_SCOPE("StorageScreen::LoadBoxData");
     LOG_DEBUG("Loading box data from provider...");
 
     auto currentSave = saveDataAccessor->getCurrentSaveData();
@@ -220,7 +222,7 @@ void StorageScreen::LoadBoxData() {
 
     // Get box count from the provider
     size_t boxCount = boxDataProvider->GetBoxCount(currentSave);
-    LOG_DEBUG("Setting box count to " + std::to_string(boxCount));
+    LOG_DEBUGF("Setting box count to {}", boxCount);
     pokemonSaveBox->SetBoxCount(boxCount);
 
     // Load all boxes at once to ensure the box data provider knows about them
@@ -105,6 +105,9 @@ pksm::layout::TitleLoadScreen::TitleLoadScreen(
 
     titleLoadFocusManager->RegisterFocusable(this->saveList);
 
+    // Backups are indexed in the background and may turn up after the list was filled
+    this->saveProvider->SetOnSavesChanged(std::bind(&TitleLoadScreen::OnSavesChanged, this, std::placeholders::_1));
+
     // Create load button
     this->loadButton = pksm::ui::FocusableButton::New(
         SAVE_LIST_X + SAVE_LIST_WIDTH + BUTTON_SPACING,
@@ -230,6 +233,18 @@ void pksm::layout::TitleLoadScreen::LoadSaves() {
     }
 }
 
+void pksm::layout::TitleLoadScreen::OnSavesChanged(u64 titleId) {
+    auto title = GetSelectedTitle();
+    if (!title || title->getTitleId() != titleId) {
+        return;
+    }
+
+    // More saves were found in the background; add them without moving the selection
+    auto saves = saveProvider->GetSavesForTitle(title, accountManager.GetCurrentAccount());
+    LOG_DEBUG("Saves changed for selected title, now " + std::to_string(saves.size()) + " saves");
+    this->saveList->UpdateDataSource(saves);
+}
+
 void pksm::layout::TitleLoadScreen::RefreshSaves() {
     try {
         LoadSaves();
@@ -242,14 +257,8 @@ pksm::titles::Title::Ref pksm::layout::TitleLoadScreen::GetSelectedTitle() const
 }
 
 pksm::saves::Save::Ref pksm::layout::TitleLoadScreen::GetSelectedSave() const {
-    int selectedIndex = this->saveList->GetSelectedIndex();
-    if (selectedIndex >= 0) {
-        auto saves = saveProvider->GetSavesForTitle(GetSelectedTitle(), accountManager.GetCurrentAccount());
-        if (selectedIndex < static_cast<int>(saves.size())) {
-            return saves[selectedIndex];
-        }
-    }
-    return nullptr;
+    // The list is what the user sees; asking the provider again could give a longer list
+    return this->saveList->GetSelectedSave();
 }
 
 void pksm::layout::TitleLoadScreen::MoveButtonSelectionUp() {
@@ -1,5 +1,7 @@
 #include "gui/screens/title-load-screen/sub-components/SaveList.hpp"
 
+#include <algorithm>
+
 #include "utils/Logger.hpp"
 
 namespace pksm::ui {
@@ -47,6 +49,26 @@ void SaveList::SetDataSource(const std::vector<saves::Save::Ref>& saves) {
     FocusableMenu::SetDataSource(displayStrings);
 }
 
+void SaveList::UpdateDataSource(const std::vector<saves::Save::Ref>& saves) {
+    const bool extendsCurrent = saves.size() >= this->saves.size() &&
+        std::equal(this->saves.begin(), this->saves.end(), saves.begin(), [](const auto& a, const auto& b) {
+            return a->getName() == b->getName() && a->getPath() == b->getPath();
+        });
+    if (!extendsCurrent) {
+        SetDataSource(saves);
+        return;
+    }
+
+    std::vector<std::string> displayStrings;
+    for (size_t i = this->saves.size(); i < saves.size(); i++) {
+        displayStrings.push_back(saves[i]->getName());
+    }
+    this->saves = saves;
+
+    LOG_DEBUG("Appending " + std::to_string(displayStrings.size()) + " saves to SaveList");
+    FocusableMenu::AppendDataSource(displayStrings);
+}
+
 saves::Save::Ref SaveList::GetSelectedSave() const {
     pu::i32 selectedIndex = GetSelectedIndex();
     if (selectedIndex >= 0 && static_cast<size_t>(selectedIndex) < saves.size()) {
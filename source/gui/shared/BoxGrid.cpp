@@ -1,7 +1,11 @@
 #include "gui/shared/components/BoxGrid.hpp"
 
+#include <algorithm>
+#include <optional>
+
 #include "gui/shared/UIConstants.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 pksm::ui::BoxGrid::BoxGrid(
     const pu::i32 x,
@@ -60,6 +64,16 @@ pu::i32 pksm::ui::BoxGrid::GetY() {
 }
 
 void pksm::ui::BoxGrid::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu::i32 x, const pu::i32 y) {
+    // Swap in sprites that finished decoding since the last frame
+    if (!pendingSpriteSlots.empty()) {
+        pu::ui::RequestRedraw();
+        std::vector<size_t> stillPending;
+        stillPending.swap(pendingSpriteSlots);
+        for (size_t slotIndex : stillPending) {
+            UpdateSlotSprite(slotIndex);
+        }
+    }
+
     // Render all items in the grid
     for (auto& item : items) {
         item->OnRender(drawer, x + item->GetX() - this->x, y + item->GetY() - this->y);
@@ -92,13 +106,14 @@ void pksm::ui::BoxGrid::SetPokemonData(int slotIndex, const BoxPokemonData& data
         // Update the displayed item if it exists
         if (static_cast<size_t>(slotIndex) < items.size()) {
             // Get the sprite for this Pokémon
-            pu::sdl2::TextureHandle::Ref texture = data.getSprite();
-            items[slotIndex]->SetImage(texture);
+            UpdateSlotSprite(static_cast<size_t>(slotIndex));
         }
     }
 }
 
 void pksm::ui::BoxGrid::SetBoxData(const BoxData& boxData) {
+    TRACE_SCOPE("BoxGrid::SetBoxData");
+
     // Make a copy of the input box data
     currentBoxData = boxData;
 
@@ -130,6 +145,7 @@ void pksm::ui::BoxGrid::UpdateGridFromBoxData() {
         }
     }
     items.clear();
+    pendingSpriteSlots.clear();
     container->Clear();
 
     // Create box items for the current box
@@ -139,14 +155,8 @@ void pksm::ui::BoxGrid::UpdateGridFromBoxData() {
         // Calculate position using IGrid's helper method
         auto position = CalculateItemPosition(i);
 
-        // Get the Pokémon data
-        BoxPokemonData& pokemonData = currentBoxData[i];
-
-        // Get the texture handle for this Pokémon
-        pu::sdl2::TextureHandle::Ref textureHandle = pokemonData.getSprite();
-
-        // Create a BoxItem for this slot
-        auto boxItem = BoxItem::New(position.first, position.second, itemSize, itemSize, textureHandle);
+        // Create a BoxItem for this slot, its sprite is filled in by UpdateSlotSprite below
+        auto boxItem = BoxItem::New(position.first, position.second, itemSize, itemSize, utils::PokemonSprite());
         boxItem->IFocusable::SetName("BoxItem Element: Slot " + std::to_string(i));
         boxItem->ISelectable::SetName("BoxItem Element: Slot " + std::to_string(i));
 
@@ -177,6 +187,7 @@ void pksm::ui::BoxGrid::UpdateGridFromBoxData() {
         // Add to our containers
         items.push_back(boxItem);
         container->Add(boxItem);
+        UpdateSlotSprite(i);
     }
 
     // Select the first item by default if we have any items
@@ -191,8 +202,24 @@ void pksm::ui::BoxGrid::UpdateGridFromBoxData() {
     }
 }
 
+void pksm::ui::BoxGrid::UpdateSlotSprite(size_t slotIndex) {
+    if (slotIndex >= items.size() || slotIndex >= currentBoxData.size()) {
+        return;
+    }
+
+    std::optional<utils::PokemonSprite> sprite = currentBoxData[slotIndex].tryGetSprite();
+    if (sprite) {
+        items[slotIndex]->SetSprite(*sprite);
+    } else {
+        items[slotIndex]->SetSpritePending();
+        if (std::find(pendingSpriteSlots.begin(), pendingSpriteSlots.end(), slotIndex) == pendingSpriteSlots.end()) {
+            pendingSpriteSlots.push_back(slotIndex);
+        }
+    }
+}
+
 void pksm::ui::BoxGrid::SetSelectedIndex(size_t index) {
-    LOG_DEBUG("[BoxGrid] Setting selected index: " + std::to_string(index));
+    LOG_DEBUGF("[BoxGrid] Setting selected index: {}", index);
     if (index < items.size() && selectedIndex != index) {
         selectedIndex = index;
 
@@ -210,13 +237,13 @@ void pksm::ui::BoxGrid::SetSelectedIndex(size_t index) {
 
 // IFocusable implementation
 void pksm::ui::BoxGrid::SetFocused(bool focused) {
-    LOG_DEBUG("[BoxGrid] SetFocused: " + std::to_string(focused));
+    LOG_DEBUGF("[BoxGrid] SetFocused: {}", focused);
     if (this->focused != focused) {
         this->focused = focused;
 
         // When gaining focus, focus the selected box item
         if (focused && !items.empty() && selectedIndex < items.size()) {
-            LOG_DEBUG("[BoxGrid] Focusing item: " + std::to_string(selectedIndex));
+            LOG_DEBUGF("[BoxGrid] Focusing item: {}", selectedIndex);
             items[selectedIndex]->RequestFocus();
         }
     }
@@ -1,5 +1,7 @@
 #include "gui/shared/components/BoxItem.hpp"
 
+#include <algorithm>
+
 #include "utils/Logger.hpp"
 
 pksm::ui::BoxItem::BoxItem(
@@ -7,7 +9,7 @@ pksm::ui::BoxItem::BoxItem(
     const pu::i32 y,
     const pu::i32 width,
     const pu::i32 height,
-    pu::sdl2::TextureHandle::Ref image,
+    const utils::PokemonSprite& sprite,
     const pu::i32 outlinePadding,
     const pu::ui::Color defaultBgColor,
     const pu::ui::Color selectedBgColor
@@ -26,6 +28,7 @@ pksm::ui::BoxItem::BoxItem(
     ),
     focused(false),
     selected(false),
+    spritePending(false),
     outlinePadding(outlinePadding),
     x(x),
     y(y),
@@ -46,16 +49,17 @@ pksm::ui::BoxItem::BoxItem(
     // Create container with elements
     container = pu::ui::Container::New(0, 0, width, height);
     background = pu::ui::elm::Rectangle::New(0, 0, width, height, defaultBgColor);
-    this->image = pu::ui::elm::Image::New(spriteX, spriteY, image);
-
-    // Set image dimensions to match container
-    this->image->SetWidth(spriteWidth);
-    this->image->SetHeight(spriteHeight);
+    this->image =
+        pksm::ui::SpriteImage::New(spriteX, spriteY, spriteWidth, spriteHeight, sprite.texture, sprite.sourceRect);
 
     // Add elements to container
     container->Add(background);
     container->Add(this->image);
 
+    // Rendered separately, only while a sprite is pending
+    placeholder = pu::ui::elm::Rectangle::New(0, 0, 0, 0, placeholderColor);
+    UpdatePlaceholderLayout();
+
     // Create the regular outline
     outline = pksm::ui::RectangularOutline::New(
         x - outlinePadding,
@@ -104,6 +108,7 @@ void pksm::ui::BoxItem::SetWidth(const pu::i32 width) {
     background->SetWidth(width);
     image->SetX(spriteX);
     image->SetWidth(spriteWidth);
+    UpdatePlaceholderLayout();
 
     // Update outlines
     pu::i32 outlineWidth = width + (outlinePadding * 2);
@@ -121,6 +126,7 @@ void pksm::ui::BoxItem::SetHeight(const pu::i32 height) {
     background->SetHeight(height);
     image->SetY(spriteY);
     image->SetHeight(spriteHeight);
+    UpdatePlaceholderLayout();
 
     // Update outlines
     pu::i32 outlineHeight = height + (outlinePadding * 2);
@@ -178,21 +184,37 @@ pu::i32 pksm::ui::BoxItem::GetHeight() {
     return height;
 }
 
-void pksm::ui::BoxItem::SetImage(pu::sdl2::TextureHandle::Ref newImage) {
+void pksm::ui::BoxItem::SetSprite(const utils::PokemonSprite& sprite) {
     static constexpr pu::i32 spriteOverscan = 12;
     const pu::i32 spriteWidth = width + spriteOverscan;
     const pu::i32 spriteHeight = height + spriteOverscan;
     const pu::i32 spriteX = (width - spriteWidth) / 2;
     const pu::i32 spriteY = (height - spriteHeight) / 2;
 
-    image->SetImage(newImage);
+    spritePending = false;
+    image->SetSprite(sprite);
     image->SetX(spriteX);
     image->SetY(spriteY);
     image->SetWidth(spriteWidth);
     image->SetHeight(spriteHeight);
 }
 
-pu::ui::elm::Image::Ref pksm::ui::BoxItem::GetImage() {
+void pksm::ui::BoxItem::SetSpritePending() {
+    spritePending = true;
+    image->SetSprite(utils::PokemonSprite());
+}
+
+void pksm::ui::BoxItem::UpdatePlaceholderLayout() {
+    // A small circle in the middle of the slot
+    const pu::i32 size = std::min(width, height) / 3;
+    placeholder->SetX((width - size) / 2);
+    placeholder->SetY((height - size) / 2);
+    placeholder->SetWidth(size);
+    placeholder->SetHeight(size);
+    placeholder->SetBorderRadius(size / 2);
+}
+
+pksm::ui::SpriteImage::Ref pksm::ui::BoxItem::GetImage() {
     return image;
 }
 
@@ -234,6 +256,10 @@ void pksm::ui::BoxItem::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu
     for (auto& element : container->GetElements()) {
         element->OnRender(drawer, x + element->GetX(), y + element->GetY());
     }
+
+    if (spritePending) {
+        placeholder->OnRender(drawer, x + placeholder->GetX(), y + placeholder->GetY());
+    }
 }
 
 void pksm::ui::BoxItem::OnInput(
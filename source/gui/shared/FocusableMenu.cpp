@@ -164,6 +164,19 @@ void pksm::ui::FocusableMenu::SetDataSource(const std::vector<std::string>& item
     }
 }
 
+void pksm::ui::FocusableMenu::AppendDataSource(const std::vector<std::string>& items) {
+    for (const auto& item : items) {
+        currentDataSource.push_back(item);
+        auto menuItem = pu::ui::elm::MenuItem::New(item);
+        menuItem->SetColor(global::TEXT_WHITE);
+        this->AddItem(menuItem);
+    }
+
+    // New items may land in the visible range
+    this->ForceReloadItems();
+    this->MarkDirty();
+}
+
 const std::vector<std::string>& pksm::ui::FocusableMenu::GetDataSource() const {
     return currentDataSource;
 }
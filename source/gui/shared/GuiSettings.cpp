@@ -0,0 +1,43 @@
+#include "gui/shared/GuiSettings.hpp"
+
+#include <filesystem>
+#include <fstream>
+#include <nlohmann/json.hpp>
+
+#include "utils/Logger.hpp"
+
+namespace pksm::ui {
+
+GuiSettings GuiSettings::Load(const std::string& path) {
+    GuiSettings settings;
+    std::ifstream file(path);
+    if (!file.is_open()) {
+        return settings;
+    }
+
+    try {
+        const nlohmann::json j = nlohmann::json::parse(file);
+        settings.backgroundAnimationPaused = j.value("backgroundAnimationPaused", settings.backgroundAnimationPaused);
+    } catch (const nlohmann::json::exception& e) {
+        LOG_ERROR("Failed to parse GUI settings " + path + ": " + std::string(e.what()));
+        return GuiSettings();
+    }
+    return settings;
+}
+
+bool GuiSettings::Save(const std::string& path) const {
+    std::error_code ec;
+    std::filesystem::create_directories(std::filesystem::path(path).parent_path(), ec);
+
+    std::ofstream file(path, std::ios::trunc);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open GUI settings for writing: " + path);
+        return false;
+    }
+
+    const nlohmann::json j = {{"backgroundAnimationPaused", backgroundAnimationPaused}};
+    file << j.dump(4);
+    return file.good();
+}
+
+}  // namespace pksm::ui
@@ -41,6 +41,7 @@ pksm::ui::ShakeOffset pksm::ui::PulsingOutlineBase::calculateShakeOffset() const
     if (!isShaking) {
         return ShakeOffset(0.0f, 0.0f);
     }
+    pu::ui::RequestRedraw();
 
     u64 currentTime = SDL_GetTicks64();
     u64 elapsedTime = currentTime - shakeStartTime;
@@ -121,6 +122,8 @@ void pksm::ui::RectangularPulsingOutline::OnRender(
     if (!visible)
         return;
 
+    // Only a focused outline is visible, and only it keeps the pulse animating
+    pu::ui::RequestRedraw();
     pu::ui::Color pulseColor = calculatePulseColor();
 
     // Calculate shake offset
@@ -130,16 +133,15 @@ void pksm::ui::RectangularPulsingOutline::OnRender(
     pu::i32 renderX = x + static_cast<pu::i32>(offset.x);
     pu::i32 renderY = y + static_cast<pu::i32>(offset.y);
 
-    for (u32 i = 0; i < borderWidth; i++) {
-        drawer->RenderRoundedRectangle(
-            pulseColor,
-            renderX + i,
-            renderY + i,
-            width - (2 * i),
-            height - (2 * i),
-            radius > static_cast<pu::i32>(i) ? radius - static_cast<pu::i32>(i) : 0
-        );
-    }
+    drawer->RenderRoundedRectangleBorder(
+        pulseColor,
+        renderX,
+        renderY,
+        width,
+        height,
+        radius,
+        static_cast<pu::i32>(borderWidth)
+    );
 }
 
 // CircularPulsingOutline implementation
@@ -156,6 +158,8 @@ void pksm::ui::CircularPulsingOutline::OnRender(pu::ui::render::Renderer::Ref& d
     if (!visible)
         return;
 
+    // Only a focused outline is visible, and only it keeps the pulse animating
+    pu::ui::RequestRedraw();
     pu::ui::Color pulseColor = calculatePulseColor();
 
     // Calculate shake offset
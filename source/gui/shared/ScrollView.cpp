@@ -93,6 +93,11 @@ void pksm::ui::ScrollView::Clear() {
 }
 
 void pksm::ui::ScrollView::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu::i32 x, const pu::i32 y) {
+    // Keep frames coming while the scroll animation or momentum is running
+    if (isAnimatingScroll || hasMomentum) {
+        pu::ui::RequestRedraw();
+    }
+
     // Update animation if active
     if (isAnimatingScroll) {
         u64 currentTime = SDL_GetTicks64();
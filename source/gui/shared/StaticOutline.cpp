@@ -36,6 +36,9 @@ void pksm::ui::StaticOutlineBase::SetHeight(const pu::i32 height) {
     this->height = height;
 }
 void pksm::ui::StaticOutlineBase::SetVisible(bool visible) {
+    if (this->visible != visible) {
+        pu::ui::RequestRedraw();
+    }
     this->visible = visible;
 }
 bool pksm::ui::StaticOutlineBase::IsVisible() const {
@@ -102,21 +105,15 @@ void pksm::ui::RectangularOutline::OnRender(pu::ui::render::Renderer::Ref& drawe
     if (!visible)
         return;
 
-    // Draw the outline by rendering rectangles with increasing size
+    if (radius > 0) {
+        // Use a rounded border if radius is specified
+        drawer->RenderRoundedRectangleBorder(color, x, y, width, height, radius, static_cast<pu::i32>(borderWidth));
+        return;
+    }
+
+    // Draw the outline by rendering rectangles with decreasing size
     for (u32 i = 0; i < borderWidth; i++) {
-        if (radius > 0) {
-            // Use rounded rectangle if radius is specified
-            drawer->RenderRoundedRectangle(
-                color,
-                x + i,
-                y + i,
-                width - (2 * i),
-                height - (2 * i),
-                radius > static_cast<pu::i32>(i) ? radius - static_cast<pu::i32>(i) : 0
-            );
-        } else {
-            // Use regular rectangle for sharp corners
-            drawer->RenderRectangle(color, x + i, y + i, width - (2 * i), height - (2 * i));
-        }
+        // Use regular rectangle for sharp corners
+        drawer->RenderRectangle(color, x + i, y + i, width - (2 * i), height - (2 * i));
     }
 }
\ No newline at end of file
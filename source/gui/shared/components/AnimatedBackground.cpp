@@ -10,6 +10,8 @@
 
 namespace pksm::ui {
 
+bool AnimatedBackground::animationPaused = false;
+
 AnimatedBackground::AnimatedBackground()
   : Element(),
     bg_textures{nullptr, nullptr, nullptr},
@@ -160,20 +162,37 @@ void AnimatedBackground::EnableBobbing(int layer, bool enabled) {
     }
 }
 
+void AnimatedBackground::SetAnimationPaused(bool paused) {
+    if (animationPaused == paused) {
+        return;
+    }
+    animationPaused = paused;
+    pu::ui::RequestRedraw();
+}
+
 void AnimatedBackground::UpdateBackgroundAnimation() {
     // Calculate time delta for smooth animation
     const auto currentTime = SDL_GetTicks64();
     const auto deltaTime = currentTime - lastFrameTime;
     lastFrameTime = currentTime;
 
+    // Time still advances while paused, so resuming doesn't jump the layers forward. A paused background
+    // requests no redraws, so screens showing it go idle until something else changes.
+    if (animationPaused) {
+        startTime += deltaTime;
+        return;
+    }
+
     // Time since animation started (for bobbing delays)
     const auto timeSinceStart = currentTime - startTime;
 
     auto [screenWidth, screenHeight] = pu::ui::render::GetDimensions();
 
+    bool animating = false;
     for (int i = 0; i < NUM_LAYERS; i++) {
         if (!bg_textures[i] || !layerConfigs[i].enabled)
             continue;
+        animating = true;
 
         // Update horizontal scrolling
         const float moveAmount = (layerConfigs[i].scrollSpeed * deltaTime) / 1000.0f;
@@ -196,6 +215,10 @@ void AnimatedBackground::UpdateBackgroundAnimation() {
                 std::sin(2.0f * M_PI * layerConfigs[i].bobFrequency * timeForBob);
         }
     }
+
+    if (animating) {
+        pu::ui::RequestRedraw();
+    }
 }
 
 void AnimatedBackground::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu::i32 x, const pu::i32 y) {
@@ -9,8 +9,13 @@ BaseLayout::BaseLayout(std::function<void(pu::ui::Overlay::Ref)> onShowOverlay,
 
 void BaseLayout::InitializeHelpFooter() {
     LOG_DEBUG("Initializing help footer");
-    helpFooter = pksm::ui::HelpFooter::New(0, GetHeight() - pksm::ui::HelpFooter::FOOTER_HEIGHT, GetWidth());
-    this->Add(helpFooter);
+    const pu::i32 footerY = GetHeight() - pksm::ui::HelpFooter::FOOTER_HEIGHT;
+    helpFooter = pksm::ui::HelpFooter::New(0, footerY, GetWidth());
+
+    // The footer only changes when its help items do, so draw it from a cached texture
+    helpFooterCache = pu::ui::elm::CachedContainer::New(0, footerY, GetWidth(), pksm::ui::HelpFooter::FOOTER_HEIGHT);
+    helpFooterCache->Add(helpFooter);
+    this->Add(helpFooterCache);
 }
 
 void BaseLayout::UpdateHelpItems(pksm::ui::IHelpProvider::Ref helpItemProvider) {
@@ -89,6 +89,7 @@ void HelpFooter::SetHelpItems(const std::vector<HelpItem>& items) {
     LOG_DEBUG("Setting help items, count: " + std::to_string(items.size()));
     helpItems = items;
     UpdateDynamicHelpTexts();
+    MarkDirty();
 }
 
 void HelpFooter::UpdateDynamicHelpTexts() {
@@ -135,6 +135,9 @@ void NotificationCenter::OnRender(pu::ui::render::Renderer::Ref& drawer, const p
         return;
     }
 
+    // Toasts slide and fade until they expire
+    pu::ui::RequestRedraw();
+
     const auto now = std::chrono::steady_clock::now();
 
     const pu::i32 screenW = static_cast<pu::i32>(pu::ui::render::ScreenWidth);
@@ -388,7 +388,7 @@ void PokemonBox::OnInput(
 }
 
 void PokemonBox::SetFocused(bool focused) {
-    LOG_DEBUG("[BoxGrid] SetFocused: " + std::to_string(focused));
+    LOG_DEBUGF("[BoxGrid] SetFocused: {}", focused);
     if (this->focused != focused) {
         this->focused = focused;
 
@@ -476,9 +476,6 @@ void PokemonBox::SetCurrentBox(int boxIndex) {
 
         // Update box counter display
         UpdateBoxCounterText();
-
-        // Update sprite cache
-        UpdateSpriteCache();
     }
 }
 
@@ -490,26 +487,24 @@ void PokemonBox::UpdateBoxGrid() {
 
     // Send the current box data to the grid
     boxGrid->SetBoxData(boxes[currentBox]);
+    PrefetchAdjacentBoxes();
 }
 
-void PokemonBox::UpdateSpriteCache() {
-    // Build a list of active sprites to keep in memory
-    std::set<std::string> activeKeys;
+void PokemonBox::PrefetchAdjacentBoxes() {
+    if (boxes.size() < 2) {
+        return;
+    }
+
+    // Box navigation wraps around, so the neighbours of the first and last box wrap too
+    const size_t boxCount = boxes.size();
+    const size_t nextBox = (static_cast<size_t>(currentBox) + 1) % boxCount;
+    const size_t previousBox = (static_cast<size_t>(currentBox) + boxCount - 1) % boxCount;
 
-    if (!boxes.empty() && static_cast<size_t>(currentBox) < boxes.size()) {
-        // Add sprites for the current box
-        for (size_t i = 0; i < boxes[currentBox].size(); i++) {
-            const auto& pokemonData = boxes[currentBox][i];
-            if (!pokemonData.isEmpty()) {
-                activeKeys.insert(
-                    utils::PokemonSpriteManager::GenerateKey(pokemonData.species, pokemonData.form, pokemonData.shiny)
-                );
-            }
+    for (size_t boxIndex : {nextBox, previousBox}) {
+        for (const BoxPokemonData& pokemon : boxes[boxIndex].pokemon) {
+            pokemon.prefetchSprite();
         }
     }
-
-    // Release sprites that aren't in the current box
-    utils::PokemonSpriteManager::ReleaseUnusedSprites(activeKeys);
 }
 
 void PokemonBox::SetPokemonData(int boxIndex, int slotIndex, const BoxPokemonData& data) {
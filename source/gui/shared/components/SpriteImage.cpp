@@ -35,7 +35,7 @@ SpriteImage::SpriteImage(
     usingSpritesheet(false) {
     // Set the Pokemon sprite
     SetPokemonSprite(species, form, shiny);
-    LOG_DEBUG("Created SpriteImage for Pokemon species " + std::to_string(species));
+    LOG_DEBUGF("Created SpriteImage for Pokemon species {}", species);
 }
 
 SpriteImage::~SpriteImage() {
@@ -60,16 +60,16 @@ pu::i32 SpriteImage::GetHeight() {
 
 void SpriteImage::OnRender(pu::ui::render::Renderer::Ref& drawer, const pu::i32 x, const pu::i32 y) {
     if (texture) {
-        // Destination rectangle
-        SDL_Rect destRect = {x, y, width, height};
-
-        // Render the texture
-        SDL_RenderCopy(
-            pu::ui::render::GetMainRenderer(),
-            texture->Get(),
-            nullptr,  // Use the entire texture
-            &destRect  // Destination rectangle
-        );
+        // Going through the renderer applies its base offset and alpha, so sprites move and fade
+        // with their layer
+        const auto opts = pu::ui::render::TextureRenderOptions::WithCustomDimensions(width, height);
+
+        // Render the clipped region, or the entire texture if there is none
+        if (clipRect.w > 0 && clipRect.h > 0) {
+            drawer->RenderTexture(texture->Get(), clipRect, x, y, opts);
+        } else {
+            drawer->RenderTexture(texture->Get(), x, y, opts);
+        }
     }
 }
 
@@ -118,6 +118,12 @@ void SpriteImage::SetImage(pu::sdl2::TextureHandle::Ref texture, const SDL_Rect*
     this->usingSpritesheet = false;
 }
 
+void SpriteImage::SetSprite(const utils::PokemonSprite& sprite) {
+    this->texture = sprite.texture;
+    this->clipRect = sprite.sourceRect;
+    this->usingSpritesheet = sprite.texture != nullptr;
+}
+
 void SpriteImage::SetPokemonSprite(u16 species, u8 form, bool shiny) {
     if (species == 0) {
         // Empty slot
@@ -127,19 +133,10 @@ void SpriteImage::SetPokemonSprite(u16 species, u8 form, bool shiny) {
     }
 
     // Get the sprite directly from PokemonSpriteManager
-    this->texture = utils::PokemonSpriteManager::GetPokemonSprite(species, form, shiny);
-
-    if (this->texture) {
-        // Set clip rect to the full texture size
-        this->clipRect = {
-            0,
-            0,
-            pu::ui::render::GetTextureWidth(this->texture->Get()),
-            pu::ui::render::GetTextureHeight(this->texture->Get())
-        };
-    } else {
+    SetSprite(utils::PokemonSpriteManager::GetPokemonSprite(species, form, shiny));
+
+    if (!this->texture) {
         LOG_ERROR("Failed to find sprite for species " + std::to_string(species));
-        this->clipRect = {0, 0, 0, 0};
     }
 }
 
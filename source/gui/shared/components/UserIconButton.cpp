@@ -5,6 +5,7 @@
 #include <SDL2/SDL_blendmode.h>
 #include <SDL2/SDL_render.h>
 #include <SDL2/SDL_timer.h>
+#include <algorithm>
 #include <chrono>
 #include <thread>
 
@@ -190,17 +191,32 @@ void UserIconButton::UpdateAccountInfo() {
             // Apply circular mask
             SDL_SetRenderDrawBlendMode(renderer, pksm::sdl::BlendModeNone());
 
+            // Outside the circle each row is a span on either side, so clear those with one fill each
+            // instead of pixel by pixel
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
             pu::i32 radius = diameter / 2;
             for (pu::i32 py = 0; py < diameter; py++) {
-                for (pu::i32 px = 0; px < diameter; px++) {
-                    const pu::i32 dx = px - radius;
-                    const pu::i32 dy = py - radius;
-                    bool inCircle = ((dx * dx) + (dy * dy)) <= (radius * radius);
-                    if (!inCircle) {
-                        // For anything outside the circle, set alpha = 0
-                        SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
-                        SDL_RenderDrawPoint(renderer, px, py);
-                    }
+                const pu::i32 dy = py - radius;
+                pu::i32 halfWidth = -1;
+                while (((halfWidth + 1) * (halfWidth + 1)) + (dy * dy) <= (radius * radius)) {
+                    halfWidth++;
+                }
+
+                if (halfWidth < 0) {
+                    const SDL_Rect rowRect = {0, py, diameter, 1};
+                    SDL_RenderFillRect(renderer, &rowRect);
+                    continue;
+                }
+
+                const pu::i32 insideStart = std::max(radius - halfWidth, 0);
+                const pu::i32 insideEnd = std::min(radius + halfWidth + 1, diameter);
+                const SDL_Rect leftRect = {0, py, insideStart, 1};
+                const SDL_Rect rightRect = {insideEnd, py, diameter - insideEnd, 1};
+                if (leftRect.w > 0) {
+                    SDL_RenderFillRect(renderer, &leftRect);
+                }
+                if (rightRect.w > 0) {
+                    SDL_RenderFillRect(renderer, &rightRect);
                 }
             }
 
@@ -3,7 +3,10 @@
 #include <switch.h>
 
 #include "PKSMApplication.hpp"
+#include "data/titles/TitleIconLoader.hpp"
 #include "utils/Logger.hpp"
+#include "utils/PokemonSpriteManager.hpp"
+#include "utils/Trace.hpp"
 
 int main(int argc, char* argv[]) {
     try {
@@ -17,7 +20,12 @@ int main(int argc, char* argv[]) {
         }
         app->ShowWithFadeIn();
 
-        // Cleanup
+        // Cleanup, stopping the decoding threads before anything they use goes away
+        pksm::utils::PokemonSpriteManager::Cleanup();
+        pksm::titles::TitleIconLoader::Cleanup();
+#ifdef PKSM_TRACE
+        pksm::utils::Tracer::WriteChromeTrace(pksm::utils::Tracer::DEFAULT_TRACE_PATH);
+#endif
         pksm::utils::Logger::Finalize();
         return 0;
     } catch (const std::exception& e) {
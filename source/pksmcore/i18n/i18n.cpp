@@ -89,9 +89,10 @@ namespace i18n
         if (found->second.compare_exchange_strong(expected, LangState::INITIALIZING))
         {
 #endif
+            // Unknown languages load into the English tables, so pass the language actually in use
             for (const auto& callback : initCallbacks)
             {
-                callback(lang);
+                callback(found->first);
             }
             found->second = LangState::INITIALIZED;
 #ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
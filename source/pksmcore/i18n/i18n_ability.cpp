@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> abilities = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> abilities;
 
     void initAbility(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/abilities.txt", vec);
-        abilities.insert_or_assign(lang, std::move(vec));
+        abilities.publish(lang, std::move(vec));
     }
 
     void exitAbility(pksm::Language lang)
     {
-        abilities[lang].clear();
+        abilities.clear(lang);
     }
 
     const std::string& ability(pksm::Language lang, pksm::Ability val)
     {
         checkInitialized(lang);
-        if (size_t(val) < abilities[lang].size())
+        const auto& table = abilities[lang];
+        if (size_t(val) < table.size())
         {
-            return abilities[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> balls = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> balls;
 
     void initBall(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/balls.txt", vec);
-        balls.insert_or_assign(lang, std::move(vec));
+        balls.publish(lang, std::move(vec));
     }
 
     void exitBall(pksm::Language lang)
     {
-        balls[lang].clear();
+        balls.clear(lang);
     }
 
     const std::string& ball(pksm::Language lang, pksm::Ball val)
     {
         checkInitialized(lang);
-        if (size_t(val) < balls[lang].size())
+        const auto& table = balls[lang];
+        if (size_t(val) < table.size())
         {
-            return balls[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
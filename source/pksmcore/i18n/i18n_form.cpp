@@ -256,24 +256,18 @@ namespace
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> formss = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> formss;
 
     void initForm(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/forms.txt", vec);
-        formss.insert_or_assign(lang, std::move(vec));
+        formss.publish(lang, std::move(vec));
     }
 
     void exitForm(pksm::Language lang)
     {
-        formss[lang].clear();
+        formss.clear(lang);
     }
 
     std::span<const size_t> formIndices(pksm::GameVersion version, pksm::Species species)
@@ -763,13 +757,14 @@ namespace i18n
         pksm::Language lang, pksm::GameVersion version, pksm::Species species, u8 form)
     {
         checkInitialized(lang);
+        const auto& table = formss[lang];
         auto indices = formIndices(version, species);
         if (form < indices.size())
         {
             size_t index = indices[form];
-            if (index < formss[lang].size())
+            if (index < table.size())
             {
-                return formss[lang][index];
+                return table[index];
             }
         }
         return emptyString;
@@ -779,13 +774,14 @@ namespace i18n
         pksm::Language lang, pksm::GameVersion version, pksm::Species species)
     {
         checkInitialized(lang);
+        const auto& table = formss[lang];
         SmallVector<std::string, 0x20> ret;
         auto indices = formIndices(version, species);
         for (const auto& index : indices)
         {
-            if (index < formss[lang].size())
+            if (index < table.size())
             {
-                ret.emplace_back(formss[lang][index]);
+                ret.emplace_back(table[index]);
             }
             else
             {
@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> games = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> games;
 
     void initGame(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/games.txt", vec);
-        games.insert_or_assign(lang, std::move(vec));
+        games.publish(lang, std::move(vec));
     }
 
     void exitGame(pksm::Language lang)
     {
-        games[lang].clear();
+        games.clear(lang);
     }
 
     const std::string& game(pksm::Language lang, pksm::GameVersion val)
     {
         checkInitialized(lang);
-        if (u8(val) < games[lang].size())
+        const auto& table = games[lang];
+        if (u8(val) < table.size())
         {
-            return games[lang][u8(val)];
+            return table[u8(val)];
         }
 
         return emptyString;
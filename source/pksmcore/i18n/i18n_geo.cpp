@@ -28,21 +28,8 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::map<u8, std::string>> countries = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::map<u8, std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
-    std::unordered_map<pksm::Language, std::map<u8, std::map<u8, std::string>>> subregions =
-        std::invoke(
-            []
-            {
-                std::unordered_map<pksm::Language, std::map<u8, std::map<u8, std::string>>> ret;
-                MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-                return ret;
-            });
+    LangTable<std::map<u8, std::string>> countries;
+    LangTable<std::map<u8, std::map<u8, std::string>>> subregions;
 
     std::string subregionFileName(u8 region)
     {
@@ -60,30 +47,31 @@ namespace i18n
     {
         std::map<u8, std::string> tmp;
         load(lang, "/countries.txt", tmp);
-        auto [place, inserted] = countries.insert_or_assign(lang, std::move(tmp));
 
         std::map<u8, std::map<u8, std::string>> tmp2;
-        for (auto i = place->second.begin(); i != place->second.end(); i++)
+        for (auto i = tmp.begin(); i != tmp.end(); i++)
         {
             load(lang, subregionFileName(i->first), tmp2[i->first]);
         }
-        subregions.insert_or_assign(lang, std::move(tmp2));
+        countries.publish(lang, std::move(tmp));
+        subregions.publish(lang, std::move(tmp2));
     }
 
     void exitGeo(pksm::Language lang)
     {
-        countries[lang].clear();
-        subregions[lang].clear();
+        countries.clear(lang);
+        subregions.clear(lang);
     }
 
     const std::string& subregion(pksm::Language lang, u8 country, u8 v)
     {
         checkInitialized(lang);
-        if (subregions[lang].count(country) > 0)
+        const auto& table = subregions[lang];
+        if (auto found = table.find(country); found != table.end())
         {
-            if (subregions[lang][country].count(v) > 0)
+            if (auto foundSub = found->second.find(v); foundSub != found->second.end())
             {
-                return subregions[lang][country][v];
+                return foundSub->second;
             }
         }
         return emptyString;
@@ -92,9 +80,10 @@ namespace i18n
     const std::string& country(pksm::Language lang, u8 v)
     {
         checkInitialized(lang);
-        if (countries[lang].count(v) > 0)
+        const auto& table = countries[lang];
+        if (auto found = table.find(v); found != table.end())
         {
-            return countries[lang][v];
+            return found->second;
         }
         return emptyString;
     }
@@ -108,9 +97,10 @@ namespace i18n
     const std::map<u8, std::string>& rawSubregions(pksm::Language lang, u8 country)
     {
         checkInitialized(lang);
-        if (subregions[lang].count(country) > 0)
+        const auto& table = subregions[lang];
+        if (auto found = table.find(country); found != table.end())
         {
-            return subregions[lang][country];
+            return found->second;
         }
         return emptyU8Map;
     }
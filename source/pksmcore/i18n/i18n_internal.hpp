@@ -35,6 +35,8 @@
 #include <atomic>
 #include <cstdio>
 #include <functional>
+#include <memory>
+#include <mutex>
 #include <sys/types.h>
 #include <time.h>
 #include <unordered_map>
@@ -57,8 +59,7 @@ extern "C" ssize_t pksmcore_getline(char **lineptr, size_t *n, FILE *stream);
 #define LANGUAGES_TO_USE JPN, ENG, FRE, ITA, GER, SPA, KOR, CHS, CHT
 #endif
 
-#define MAKE_GENERIC_LANGMAP(lang) \
-    ret.insert_or_assign(pksm::Language::lang, decltype(ret)::mapped_type{});
+#define MAKE_LANGTABLE_SLOT(lang) slots.try_emplace(pksm::Language::lang);
 
 namespace i18n
 {
@@ -98,6 +99,87 @@ namespace i18n
 #endif
     }
 
+    // Per-language storage for one category of strings. Each language's table is built in full by
+    // its init callback, then published as an immutable snapshot with a single pointer swap, so
+    // lookups are one atomic load and never block, even while another thread loads a language.
+    // The set of languages is fixed on construction, so the map itself is never modified.
+    template <typename T>
+    class LangTable
+    {
+    public:
+        LangTable() { MAP(MAKE_LANGTABLE_SLOT, LANGUAGES_TO_USE) }
+
+        LangTable(const LangTable&)            = delete;
+        LangTable& operator=(const LangTable&) = delete;
+
+        // Returns an empty table if lang hasn't been published yet
+        [[nodiscard]] const T& operator[](pksm::Language lang) const
+        {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+            const T* table = slot(lang).current;
+#else
+            const T* table = slot(lang).current.load(std::memory_order_acquire);
+#endif
+            return table ? *table : empty;
+        }
+
+        // References into a snapshot stay valid until clear is called for its language, even if
+        // another snapshot is published over it in the meantime
+        void publish(pksm::Language lang, T&& value)
+        {
+            Slot& dest = slot(lang);
+#ifndef _PKSMCORE_DISABLE_THREAD_SAFETY
+            std::lock_guard<std::mutex> lock(dest.writeMutex);
+#endif
+            dest.owned.emplace_back(std::make_unique<const T>(std::move(value)));
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+            dest.current = dest.owned.back().get();
+#else
+            dest.current.store(dest.owned.back().get(), std::memory_order_release);
+#endif
+        }
+
+        void clear(pksm::Language lang)
+        {
+            Slot& dest = slot(lang);
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+            dest.current = nullptr;
+#else
+            std::lock_guard<std::mutex> lock(dest.writeMutex);
+            dest.current.store(nullptr, std::memory_order_release);
+#endif
+            dest.owned.clear();
+        }
+
+    private:
+        struct Slot
+        {
+#ifdef _PKSMCORE_DISABLE_THREAD_SAFETY
+            const T* current = nullptr;
+#else
+            std::atomic<const T*> current = nullptr;
+            std::mutex writeMutex;
+#endif
+            std::vector<std::unique_ptr<const T>> owned;
+        };
+
+        // Unknown languages use the English slot, matching checkInitialized and init
+        Slot& slot(pksm::Language lang)
+        {
+            auto found = slots.find(lang);
+            return found != slots.end() ? found->second : slots.find(pksm::Language::ENG)->second;
+        }
+
+        const Slot& slot(pksm::Language lang) const
+        {
+            auto found = slots.find(lang);
+            return found != slots.end() ? found->second : slots.find(pksm::Language::ENG)->second;
+        }
+
+        std::unordered_map<pksm::Language, Slot> slots;
+        static inline const T empty{};
+    };
+
     std::string folder(pksm::Language lang);
 
     void load(pksm::Language lang, const std::string &name, std::vector<std::string> &array);
@@ -28,34 +28,10 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> items = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
-    std::unordered_map<pksm::Language, std::vector<std::string>> items1 = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
-    std::unordered_map<pksm::Language, std::vector<std::string>> items2 = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
-    std::unordered_map<pksm::Language, std::vector<std::string>> items3 = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> items;
+    LangTable<std::vector<std::string>> items1;
+    LangTable<std::vector<std::string>> items2;
+    LangTable<std::vector<std::string>> items3;
 
     void initItem(pksm::Language lang)
     {
@@ -65,56 +41,57 @@ namespace i18n
         // HM07 & HM08
         vec[426] = vec[425].substr(0, vec[425].size() - 1) + '7';
         vec[427] = vec[425].substr(0, vec[425].size() - 1) + '8';
-        items.insert_or_assign(lang, std::move(vec));
+        items.publish(lang, std::move(vec));
     }
 
     void initItem1(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/items1.txt", vec);
-        items1.insert_or_assign(lang, std::move(vec));
+        items1.publish(lang, std::move(vec));
     }
 
     void initItem2(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/items2.txt", vec);
-        items2.insert_or_assign(lang, std::move(vec));
+        items2.publish(lang, std::move(vec));
     }
 
     void initItem3(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/items3.txt", vec);
-        items3.insert_or_assign(lang, std::move(vec));
+        items3.publish(lang, std::move(vec));
     }
 
     void exitItem(pksm::Language lang)
     {
-        items[lang].clear();
+        items.clear(lang);
     }
 
     void exitItem1(pksm::Language lang)
     {
-        items1[lang].clear();
+        items1.clear(lang);
     }
 
     void exitItem2(pksm::Language lang)
     {
-        items2[lang].clear();
+        items2.clear(lang);
     }
 
     void exitItem3(pksm::Language lang)
     {
-        items3[lang].clear();
+        items3.clear(lang);
     }
 
     const std::string& item(pksm::Language lang, u16 val)
     {
         checkInitialized(lang);
-        if (val < items[lang].size())
+        const auto& table = items[lang];
+        if (val < table.size())
         {
-            return items[lang][val];
+            return table[val];
         }
         return emptyString;
     }
@@ -122,9 +99,10 @@ namespace i18n
     const std::string& item1(pksm::Language lang, u8 val)
     {
         checkInitialized(lang);
-        if (val < items1[lang].size())
+        const auto& table = items1[lang];
+        if (val < table.size())
         {
-            return items1[lang][val];
+            return table[val];
         }
         return emptyString;
     }
@@ -132,9 +110,10 @@ namespace i18n
     const std::string& item2(pksm::Language lang, u8 val)
     {
         checkInitialized(lang);
-        if (val < items2[lang].size())
+        const auto& table = items2[lang];
+        if (val < table.size())
         {
-            return items2[lang][val];
+            return table[val];
         }
         return emptyString;
     }
@@ -142,9 +121,10 @@ namespace i18n
     const std::string& item3(pksm::Language lang, u16 val)
     {
         checkInitialized(lang);
-        if (val < items3[lang].size())
+        const auto& table = items3[lang];
+        if (val < table.size())
         {
-            return items3[lang][val];
+            return table[val];
         }
         return emptyString;
     }
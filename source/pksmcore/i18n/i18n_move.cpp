@@ -28,32 +28,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> moves = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> moves;
 
     void initMove(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/moves.txt", vec);
-        moves.insert_or_assign(lang, std::move(vec));
+        moves.publish(lang, std::move(vec));
     }
 
     void exitMove(pksm::Language lang)
     {
-        moves[lang].clear();
+        moves.clear(lang);
     }
 
     const std::string& move(pksm::Language lang, pksm::Move val)
     {
         checkInitialized(lang);
-        if (size_t(val) < moves[lang].size())
+        const auto& table = moves[lang];
+        if (size_t(val) < table.size())
         {
-            return moves[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
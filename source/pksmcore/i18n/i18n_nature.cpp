@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> natures = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> natures;
 
     void initNature(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/natures.txt", vec);
-        natures.insert_or_assign(lang, std::move(vec));
+        natures.publish(lang, std::move(vec));
     }
 
     void exitNature(pksm::Language lang)
     {
-        natures[lang].clear();
+        natures.clear(lang);
     }
 
     const std::string& nature(pksm::Language lang, pksm::Nature val)
     {
         checkInitialized(lang);
-        if (size_t(val) < natures[lang].size())
+        const auto& table = natures[lang];
+        if (size_t(val) < table.size())
         {
-            return natures[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
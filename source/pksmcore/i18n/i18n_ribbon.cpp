@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> ribbons = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> ribbons;
 
     void initRibbon(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/ribbons.txt", vec);
-        ribbons.insert_or_assign(lang, std::move(vec));
+        ribbons.publish(lang, std::move(vec));
     }
 
     void exitRibbon(pksm::Language lang)
     {
-        ribbons[lang].clear();
+        ribbons.clear(lang);
     }
 
     const std::string& ribbon(pksm::Language lang, pksm::Ribbon val)
     {
         checkInitialized(lang);
-        if (size_t(val) < ribbons[lang].size())
+        const auto& table = ribbons[lang];
+        if (size_t(val) < table.size())
         {
-            return ribbons[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> speciess = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> speciess;
 
     void initSpecies(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/species.txt", vec);
-        speciess.insert_or_assign(lang, std::move(vec));
+        speciess.publish(lang, std::move(vec));
     }
 
     void exitSpecies(pksm::Language lang)
     {
-        speciess[lang].clear();
+        speciess.clear(lang);
     }
 
     const std::string& species(pksm::Language lang, pksm::Species val)
     {
         checkInitialized(lang);
-        if (size_t(val) < speciess[lang].size())
+        const auto& table = speciess[lang];
+        if (size_t(val) < table.size())
         {
-            return speciess[lang][size_t(val)];
+            return table[size_t(val)];
         }
 
         return emptyString;
@@ -29,32 +29,27 @@
 
 namespace i18n
 {
-    std::unordered_map<pksm::Language, std::vector<std::string>> types = std::invoke(
-        []
-        {
-            std::unordered_map<pksm::Language, std::vector<std::string>> ret;
-            MAP(MAKE_GENERIC_LANGMAP, LANGUAGES_TO_USE)
-            return ret;
-        });
+    LangTable<std::vector<std::string>> types;
 
     void initType(pksm::Language lang)
     {
         std::vector<std::string> vec;
         load(lang, "/types.txt", vec);
-        types.insert_or_assign(lang, std::move(vec));
+        types.publish(lang, std::move(vec));
     }
 
     void exitType(pksm::Language lang)
     {
-        types[lang].clear();
+        types.clear(lang);
     }
 
     const std::string& type(pksm::Language lang, pksm::Type val)
     {
         checkInitialized(lang);
-        if (size_t(val) < types[lang].size())
+        const auto& table = types[lang];
+        if (size_t(val) < table.size())
         {
-            return types[lang][size_t(val)];
+            return table[size_t(val)];
         }
         return emptyString;
     }
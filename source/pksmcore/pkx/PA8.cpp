@@ -342,6 +342,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x60, 13));
     }
 
+    std::string_view PA8::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x60, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PA8::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x60, 13);
@@ -458,6 +465,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x110, 13));
     }
 
+    std::string_view PA8::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x110, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PA8::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x110, 13);
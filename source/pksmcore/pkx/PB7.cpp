@@ -337,6 +337,12 @@ namespace pksm
         return StringUtils::getString(data, 0x40, 12);
     }
 
+    std::string_view PB7::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(data, 0x40, 12, buffer);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PB7::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, v, 0x40, 12);
@@ -523,6 +529,12 @@ namespace pksm
         return StringUtils::getString(data, 0xB0, 12);
     }
 
+    std::string_view PB7::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(data, 0xB0, 12, buffer);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PB7::otName(const std::string_view& v)
     {
         StringUtils::setString(data, v, 0xB0, 12);
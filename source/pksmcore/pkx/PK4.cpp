@@ -597,6 +597,13 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString4(data, 0x48, 11));
     }
 
+    std::string_view PK4::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString4(
+            data, 0x48, 11, buffer, StringUtils::CodepointSwap::Gen45);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK4::nickname(const std::string_view& v)
     {
         StringUtils::setString4(data, StringUtils::transString45(v), 0x48, 11);
@@ -617,6 +624,13 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString4(data, 0x68, 8));
     }
 
+    std::string_view PK4::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString4(
+            data, 0x68, 8, buffer, StringUtils::CodepointSwap::Gen45);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK4::otName(const std::string_view& v)
     {
         StringUtils::setString4(data, StringUtils::transString45(v), 0x68, 8);
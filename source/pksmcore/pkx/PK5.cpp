@@ -702,6 +702,13 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString(data, 0x48, 11, u'\uFFFF'));
     }
 
+    std::string_view PK5::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x48, 11, buffer, u'\uFFFF', StringUtils::CodepointSwap::Gen45);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK5::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString45(v), 0x48, 11, u'\uFFFF', 0);
@@ -722,6 +729,13 @@ namespace pksm
         return StringUtils::transString45(StringUtils::getString(data, 0x68, 8, u'\uFFFF'));
     }
 
+    std::string_view PK5::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x68, 8, buffer, u'\uFFFF', StringUtils::CodepointSwap::Gen45);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK5::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString45(v), 0x68, 8, u'\uFFFF', 0);
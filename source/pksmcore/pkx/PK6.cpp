@@ -554,6 +554,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x40, 13));
     }
 
+    std::string_view PK6::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x40, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK6::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x40, 13);
@@ -791,6 +798,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xB0, 13));
     }
 
+    std::string_view PK6::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0xB0, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK6::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
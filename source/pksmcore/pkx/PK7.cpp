@@ -505,6 +505,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x40, 13));
     }
 
+    std::string_view PK7::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x40, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK7::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x40, 13);
@@ -722,6 +729,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xB0, 13));
     }
 
+    std::string_view PK7::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0xB0, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK7::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xB0, 13);
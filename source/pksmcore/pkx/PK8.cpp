@@ -663,6 +663,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0x58, 13));
     }
 
+    std::string_view PK8::nicknameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0x58, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK8::nickname(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0x58, 13);
@@ -940,6 +947,13 @@ namespace pksm
         return StringUtils::transString67(StringUtils::getString(data, 0xF8, 13));
     }
 
+    std::string_view PK8::otNameView(NameBuffer& buffer) const
+    {
+        size_t size = StringUtils::getString(
+            data, 0xF8, 13, buffer, u'\0', StringUtils::CodepointSwap::Gen67);
+        return std::string_view(buffer.data(), size);
+    }
+
     void PK8::otName(const std::string_view& v)
     {
         StringUtils::setString(data, StringUtils::transString67(v), 0xF8, 13);
@@ -40,6 +40,25 @@
 #include "utils/random.hpp"
 #include "utils/VersionTables.hpp"
 
+namespace
+{
+    // Fallback for generations without an allocation-free decoder. Truncates at a UTF-8 character
+    // boundary if the name somehow doesn't fit.
+    std::string_view copyToNameBuffer(const std::string& name, pksm::PKX::NameBuffer& buffer)
+    {
+        size_t size = std::min(name.size(), buffer.size());
+        if (size < name.size())
+        {
+            while (size > 0 && (name[size] & 0xC0) == 0x80)
+            {
+                size--;
+            }
+        }
+        std::copy(name.begin(), name.begin() + size, buffer.begin());
+        return std::string_view(buffer.data(), size);
+    }
+}
+
 namespace pksm
 {
     Gender PKX::genderFromRatio(u32 pid, u8 gt)
@@ -353,6 +372,16 @@ namespace pksm
         }
     }
 
+    std::string_view PKX::nicknameView(NameBuffer& buffer) const
+    {
+        return copyToNameBuffer(nickname(), buffer);
+    }
+
+    std::string_view PKX::otNameView(NameBuffer& buffer) const
+    {
+        return copyToNameBuffer(otName(), buffer);
+    }
+
     void PKX::healPP(void)
     {
         for (int i = 0; i < 4; i++)
@@ -29,7 +29,6 @@
 #include "g1values.hpp"
 #include "g2values.hpp"
 #include "g3values.hpp"
-#include <algorithm>
 
 namespace pksm
 {
@@ -77,17 +76,11 @@ namespace pksm
 
     u8 ItemConverter::nationalToG1(u16 v)
     {
-        if (v == 0)
+        if (v < internal::itemToG1.size())
         {
-            return 0;
+            return internal::itemToG1[v];
         }
-
-        auto it = std::find(internal::g1ToItem.begin(), internal::g1ToItem.end(), v);
-        if (it == internal::g1ToItem.end())
-        {
-            return 0;
-        }
-        return std::distance(internal::g1ToItem.begin(), it);
+        return 0;
     }
 
     u16 ItemConverter::g2ToNational(u8 v)
@@ -98,17 +91,11 @@ namespace pksm
 
     u8 ItemConverter::nationalToG2(u16 v)
     {
-        if (v == 0)
-        {
-            return 0;
-        }
-
-        auto it = std::find(internal::g2ToItem.begin(), internal::g2ToItem.end(), v);
-        if (it == internal::g2ToItem.end())
+        if (v < internal::itemToG2.size())
         {
-            return 0;
+            return internal::itemToG2[v];
         }
-        return std::distance(internal::g2ToItem.begin(), it);
+        return 0;
     }
 
     u16 ItemConverter::g3ToNational(u16 v)
@@ -122,16 +109,10 @@ namespace pksm
 
     u16 ItemConverter::nationalToG3(u16 v)
     {
-        if (v == 0)
-        {
-            return 0;
-        }
-
-        auto it = std::find(internal::g3ToItem.begin(), internal::g3ToItem.end(), v);
-        if (it == internal::g3ToItem.end())
+        if (v < internal::itemToG3.size())
         {
-            return 0;
+            return internal::itemToG3[v];
         }
-        return std::distance(internal::g3ToItem.begin(), it);
+        return 0;
     }
 }
@@ -27,6 +27,7 @@
 #ifndef G1VALUES_HPP
 #define G1VALUES_HPP
 
+#include "inversetable.hpp"
 #include "utils/coretypes.h"
 #include <array>
 
@@ -70,6 +71,9 @@ namespace pksm::internal
         337, 338, 339, 340, 341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354,
         355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372,
         373, 374, 375, 376, 377, 378, 379, 380, 381, 382};
+
+    // index is modern item, value is Gen I item
+    constexpr auto itemToG1 = makeInverseTable<u8, g1ToItem>();
 }
 
 #endif
@@ -27,6 +27,7 @@
 #ifndef G2VALUES_HPP
 #define G2VALUES_HPP
 
+#include "inversetable.hpp"
 #include "utils/coretypes.h"
 #include <array>
 
@@ -52,6 +53,9 @@ namespace pksm::internal
         354, 355, 355, 356, 357, 358, 359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370,
         371, 372, 373, 374, 375, 376, 377, 420, 421, 422, 423, 424, 425, 426, 427, 128 /*HM09*/,
         128 /*HM10*/, 128 /*HM11*/, 128 /*HM12*/, 128 /*Cancel*/};
+
+    // index is modern item, value is Gen II item
+    constexpr auto itemToG2 = makeInverseTable<u8, g2ToItem>();
 }
 
 #endif
@@ -27,6 +27,7 @@
 #ifndef G3VALUES_H
 #define G3VALUES_H
 
+#include "inversetable.hpp"
 #include "utils/coretypes.h"
 #include <array>
 
@@ -99,6 +100,9 @@ namespace pksm::internal
         341, 342, 343, 344, 345, 346, 347, 348, 349, 350, 351, 352, 353, 354, 355, 356, 357, 358,
         359, 360, 361, 362, 363, 364, 365, 366, 367, 368, 369, 370, 371, 372, 373, 374, 375, 376,
         377};
+
+    // Index = item, value = g3 item
+    constexpr auto itemToG3 = makeInverseTable<u16, g3ToItem>();
 }
 
 #endif
@@ -29,6 +29,7 @@
 
 #include "utils/coretypes.h"
 #include <array>
+#include <cstddef>
 
 namespace pksm::internal
 {
@@ -436,6 +437,62 @@ namespace pksm::internal
         4357, 4358, 4359, 4360, 4361, 4362, 4363, 4364, 4365, 4366, 4367, 4368, 4369, 4370, 4449,
         4450, 4451, 4452, 4453, 4454, 4455, 4456, 4457, 4461, 4462, 4466, 4467, 4469, 47252, 49968,
         50108, 50388, 52012, 65535};
+
+    // Two-level direct-mapped tables built from G4Values/G4Chars at compile time. The high byte of
+    // the key selects a 256-entry page (page 0 is always empty) and the low byte indexes into it.
+    // 0 is never a valid character or game value, so it marks unmapped entries in both directions.
+    template <size_t PageCount>
+    struct G4LookupTable
+    {
+        std::array<u8, 256> pageIndex{};
+        std::array<std::array<u16, 256>, PageCount> pages{};
+
+        [[nodiscard]] constexpr u16 operator[](u16 key) const
+        {
+            return pages[pageIndex[key >> 8]][key & 0xFF];
+        }
+    };
+
+    template <const auto& Keys>
+    consteval size_t g4LookupPageCount()
+    {
+        std::array<bool, 256> used{};
+        size_t count = 1;
+        for (const u16 key : Keys)
+        {
+            if (!used[key >> 8])
+            {
+                used[key >> 8] = true;
+                count++;
+            }
+        }
+        return count;
+    }
+
+    template <const auto& Keys, const auto& Values>
+    consteval auto makeG4LookupTable()
+    {
+        G4LookupTable<g4LookupPageCount<Keys>()> ret;
+        size_t nextPage = 1;
+        for (size_t i = 0; i < Keys.size(); i++)
+        {
+            const u16 key = Keys[i];
+            if (ret.pageIndex[key >> 8] == 0)
+            {
+                ret.pageIndex[key >> 8] = nextPage++;
+            }
+            u16& entry = ret.pages[ret.pageIndex[key >> 8]][key & 0xFF];
+            // Keep the first match, which is what a linear search over the source table returns
+            if (entry == 0)
+            {
+                entry = Values[i];
+            }
+        }
+        return ret;
+    }
+
+    inline constexpr auto G4Decode = makeG4LookupTable<G4Values, G4Chars>();
+    inline constexpr auto G4Encode = makeG4LookupTable<G4Chars, G4Values>();
 }
 
 #endif
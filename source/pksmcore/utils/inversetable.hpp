@@ -0,0 +1,53 @@
+/*
+ *   This file is part of PKSM-Core
+ *   Copyright (C) 2016-2025 Bernardo Giordano, Admiral Fish, piepie62
+ *
+ *   This program is free software: you can redistribute it and/or modify
+ *   it under the terms of the GNU General Public License as published by
+ *   the Free Software Foundation, either version 3 of the License, or
+ *   (at your option) any later version.
+ *
+ *   This program is distributed in the hope that it will be useful,
+ *   but WITHOUT ANY WARRANTY; without even the implied warranty of
+ *   MERCHANTABILITY or FITNESS FOR A PARTICULAR PURPOSE.  See the
+ *   GNU General Public License for more details.
+ *
+ *   You should have received a copy of the GNU General Public License
+ *   along with this program.  If not, see <http://www.gnu.org/licenses/>.
+ *
+ *   Additional Terms 7.b and 7.c of GPLv3 apply to this file:
+ *       * Requiring preservation of specified reasonable legal notices or
+ *         author attributions in that material or in the Appropriate Legal
+ *         Notices displayed by works containing it.
+ *       * Prohibiting misrepresentation of the origin of that material,
+ *         or requiring that modified versions of such material be marked in
+ *         reasonable ways as different from the original version.
+ */
+
+
+#ifndef INVERSETABLE_HPP
+#define INVERSETABLE_HPP
+
+#include "utils/coretypes.h"
+#include <algorithm>
+#include <array>
+#include <cstddef>
+
+namespace pksm::internal
+{
+    // Builds the reverse of a legacy-index -> modern-value table at compile time: the returned
+    // array is indexed by modern value and holds the first legacy index mapping to it, or 0 if none
+    // does. Lookups through it give the same results as a std::find over the source table.
+    template <typename IndexType, const auto& Table>
+    consteval auto makeInverseTable()
+    {
+        std::array<IndexType, size_t(*std::max_element(Table.begin(), Table.end())) + 1> ret{};
+        for (size_t i = Table.size(); i-- > 0;)
+        {
+            ret[Table[i]] = IndexType(i);
+        }
+        return ret;
+    }
+}
+
+#endif
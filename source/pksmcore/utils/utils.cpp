@@ -32,6 +32,7 @@
 #include "utils/endian.hpp"
 #include <algorithm>
 #include <array>
+#include <cstring>
 #include <map>
 #include <queue>
 #include <vector>
@@ -334,6 +335,66 @@ namespace
         return codepoint;
     }
 
+    // Unrepresentable codepoints map to 0x0000, same as the table's own unmapped entries
+    u16 codepointToG4(char32_t codepoint)
+    {
+        return codepoint > 0xFFFF ? 0x0000 : pksm::internal::G4Encode[codepoint];
+    }
+
+    char32_t swapCodepoints(char32_t codepoint, StringUtils::CodepointSwap swap)
+    {
+        switch (swap)
+        {
+            case StringUtils::CodepointSwap::Gen45:
+                return swapCodepoints45(codepoint);
+            case StringUtils::CodepointSwap::Gen67:
+                return swapCodepoints67(codepoint);
+            default:
+                return codepoint;
+        }
+    }
+
+    // Appends codepoint to out at written as UTF-8 if it fits, returning whether it did
+    bool appendUTF8(std::span<char> out, size_t& written, char32_t codepoint)
+    {
+        auto [data, size] = StringUtils::codepointToUTF8(codepoint);
+        if (written + size > out.size())
+        {
+            return false;
+        }
+        std::copy(data.begin(), data.begin() + size, out.begin() + written);
+        written += size;
+        return true;
+    }
+
+    // Returns the number of leading ASCII code units in src. Checks 16 bytes per step by testing the
+    // high bits of each code unit in two 64-bit words before falling back to one unit at a time.
+    template <typename CharType>
+    size_t asciiPrefixLength(const CharType* src, size_t size)
+    {
+        static_assert(sizeof(CharType) == 1 || sizeof(CharType) == 2);
+        static constexpr size_t UNITS_PER_STEP = 16 / sizeof(CharType);
+        static constexpr u64 NON_ASCII_MASK =
+            sizeof(CharType) == 1 ? 0x8080'8080'8080'8080 : 0xFF80'FF80'FF80'FF80;
+
+        size_t i = 0;
+        for (; i + UNITS_PER_STEP <= size; i += UNITS_PER_STEP)
+        {
+            u64 low, high;
+            std::memcpy(&low, src + i, sizeof(low));
+            std::memcpy(&high, src + i + UNITS_PER_STEP / 2, sizeof(high));
+            if ((low | high) & NON_ASCII_MASK)
+            {
+                break;
+            }
+        }
+        while (i < size && std::make_unsigned_t<CharType>(src[i]) < 0x80)
+        {
+            i++;
+        }
+        return i;
+    }
+
     // Converts a single latin character from half-width to full-width
     char16_t tofullwidth(char16_t c)
     {
@@ -349,18 +410,65 @@ namespace
     }
 }
 
-std::u16string StringUtils::UTF8toUTF16(const std::string_view& src)
+size_t StringUtils::internal::transcodeUTF8toUTF16(const std::string_view& src, char16_t* out)
 {
-    std::u16string ret;
-    ret.reserve(src.size());
-    size_t i = 0;
+    char16_t* outStart = out;
+    size_t i           = 0;
     while (i < src.size())
     {
+        size_t ascii = asciiPrefixLength(src.data() + i, src.size() - i);
+        for (size_t j = 0; j < ascii; j++)
+        {
+            out[j] = char16_t(src[i + j]);
+        }
+        out += ascii;
+        i   += ascii;
+        if (i == src.size())
+        {
+            break;
+        }
+
         auto [codepoint, advance] = UTF8toCodepoint(src.data() + i, src.size() - i);
         auto [data, newSize]      = codepointToUTF16(codepoint);
-        ret.append(data.data(), newSize);
-        i += advance;
+        std::copy(data.begin(), data.begin() + newSize, out);
+        out += newSize;
+        i   += advance;
+    }
+    return out - outStart;
+}
+
+size_t StringUtils::internal::transcodeUTF16toUTF8(const std::u16string_view& src, char* out)
+{
+    char* outStart = out;
+    size_t i       = 0;
+    while (i < src.size())
+    {
+        size_t ascii = asciiPrefixLength(src.data() + i, src.size() - i);
+        for (size_t j = 0; j < ascii; j++)
+        {
+            out[j] = char(src[i + j]);
+        }
+        out += ascii;
+        i   += ascii;
+        if (i == src.size())
+        {
+            break;
+        }
+
+        auto [codepoint, advance] = UTF16toCodepoint(src.data() + i, src.size() - i);
+        auto [data, newSize]      = codepointToUTF8(codepoint);
+        std::copy(data.begin(), data.begin() + newSize, out);
+        out += newSize;
+        i   += advance;
     }
+    return out - outStart;
+}
+
+std::u16string StringUtils::UTF8toUTF16(const std::string_view& src)
+{
+    // A UTF-8 string never has fewer code units than its UTF-16 equivalent
+    std::u16string ret(src.size(), u'\0');
+    ret.resize(internal::transcodeUTF8toUTF16(src, ret.data()));
     return ret;
 }
 
@@ -395,16 +503,9 @@ std::u32string StringUtils::UTF8toUTF32(const std::string_view& src)
 
 std::string StringUtils::UTF16toUTF8(const std::u16string_view& src)
 {
-    std::string ret;
-    ret.reserve(src.size()); // Size must be greater than or equal to this
-    size_t i = 0;
-    while (i < src.size())
-    {
-        auto [codepoint, advance] = UTF16toCodepoint(src.data() + i, src.size() - i);
-        auto [data, newSize]      = codepointToUTF8(codepoint);
-        ret.append(data.data(), newSize);
-        i += advance;
-    }
+    // Each UTF-16 code unit becomes at most three bytes; surrogate pairs become four
+    std::string ret(src.size() * 3, '\0');
+    ret.resize(internal::transcodeUTF16toUTF8(src, ret.data()));
     return ret;
 }
 
@@ -640,8 +741,8 @@ std::u16string StringUtils::getUCS2String(const u8* data, int ofs, int len, char
 
 std::string StringUtils::getString(const u8* data, int ofs, int len, char16_t term)
 {
-    std::string ret;
-    ret.reserve(len);
+    std::string ret(std::max(len, 0) * 3, '\0');
+    char* out = ret.data();
     for (int i = 0; i < len; i++)
     {
         char16_t codeunit = LittleEndian::convertTo<char16_t>(data + ofs + i * 2);
@@ -649,12 +750,43 @@ std::string StringUtils::getString(const u8* data, int ofs, int len, char16_t te
         {
             break;
         }
+        if (codeunit < 0x80)
+        {
+            *out++ = char(codeunit);
+            continue;
+        }
         auto [data, size] = codepointToUTF8((char32_t)codeunit);
-        ret.append(data.data(), size);
+        out = std::copy(data.begin(), data.begin() + size, out);
     }
+    ret.resize(out - ret.data());
     return ret;
 }
 
+size_t StringUtils::getString(
+    const u8* data, int ofs, int len, std::span<char> out, char16_t term, CodepointSwap swap)
+{
+    size_t written = 0;
+    for (int i = 0; i < len; i++)
+    {
+        char16_t codeunit = LittleEndian::convertTo<char16_t>(data + ofs + i * 2);
+        if (codeunit == term)
+        {
+            break;
+        }
+        char32_t codepoint = codeunit;
+        // Swapping goes through UTF-16, which can't carry lone surrogates
+        if (swap != CodepointSwap::None && codeunit >= 0xD800 && codeunit <= 0xDFFF)
+        {
+            codepoint = CODEPOINT_INVALID;
+        }
+        if (!appendUTF8(out, written, swapCodepoints(codepoint, swap)))
+        {
+            break;
+        }
+    }
+    return written;
+}
+
 void StringUtils::setString(
     u8* data, const std::u32string_view& v, int ofs, int len, char16_t terminator, char16_t padding)
 {
@@ -696,6 +828,20 @@ void StringUtils::setString(
     size_t i   = 0;
     while (i < v.size() && outOfs < len - 1)
     {
+        size_t ascii = std::min(
+            asciiPrefixLength(v.data() + i, v.size() - i), size_t(len - 1 - outOfs));
+        for (size_t j = 0; j < ascii; j++)
+        {
+            data[ofs + outOfs * 2]     = u8(v[i + j]);
+            data[ofs + outOfs * 2 + 1] = 0;
+            outOfs++;
+        }
+        i += ascii;
+        if (i == v.size() || outOfs == len - 1)
+        {
+            break;
+        }
+
         auto [codepoint, size] = UTF8toCodepoint(v.data() + i, v.size() - i);
         LittleEndian::convertFrom<char16_t>(data + ofs + outOfs++ * 2, codepointToUCS2(codepoint));
         i += size;
@@ -711,6 +857,7 @@ void StringUtils::setString(
 std::string StringUtils::getString4(const u8* data, int ofs, int len)
 {
     std::string output;
+    output.reserve(len);
     len *= 2;
     for (u8 i = 0; i < len; i += 2)
     {
@@ -719,16 +866,9 @@ std::string StringUtils::getString4(const u8* data, int ofs, int len)
         {
             break;
         }
-        auto found =
-            std::find(pksm::internal::G4Values.begin(), pksm::internal::G4Values.end(), temp);
+        u16 codepoint = pksm::internal::G4Decode[temp];
         // Treat an invalid value as a terminator
-        if (found == pksm::internal::G4Values.end())
-        {
-            break;
-        }
-        u16 codepoint =
-            pksm::internal::G4Chars[std::distance(pksm::internal::G4Values.begin(), found)];
-        if (codepoint == 0xFFFF)
+        if (codepoint == 0 || codepoint == 0xFFFF)
         {
             break;
         }
@@ -738,24 +878,40 @@ std::string StringUtils::getString4(const u8* data, int ofs, int len)
     return output;
 }
 
+size_t StringUtils::getString4(
+    const u8* data, int ofs, int len, std::span<char> out, CodepointSwap swap)
+{
+    size_t written = 0;
+    for (int i = 0; i < len; i++)
+    {
+        u16 codepoint = pksm::internal::G4Decode[LittleEndian::convertTo<u16>(data + ofs + i * 2)];
+        // Treat an invalid value as a terminator
+        if (codepoint == 0 || codepoint == 0xFFFF)
+        {
+            break;
+        }
+        if (!appendUTF8(out, written, swapCodepoints(codepoint, swap)))
+        {
+            break;
+        }
+    }
+    return written;
+}
+
 std::vector<u16> StringUtils::stringToG4(const std::string_view& v)
 {
     std::vector<u16> ret;
+    ret.reserve(v.length() + 1);
     size_t charIndex = 0;
     while (charIndex < v.length())
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
-        ret.push_back(
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+        ret.push_back(codepointToG4(codepoint));
 
         charIndex += size;
     }
-    if (ret.back() != 0xFFFF)
+    if (ret.empty() || ret.back() != 0xFFFF)
     {
         ret.push_back(0xFFFF);
     }
@@ -769,12 +925,7 @@ void StringUtils::setString4(u8* data, const std::string_view& v, int ofs, int l
     {
         auto [codepoint, size] = UTF8toCodepoint(v.data() + charIndex, v.length() - charIndex);
 
-        auto found =
-            std::find(pksm::internal::G4Chars.begin(), pksm::internal::G4Chars.end(), codepoint);
-        LittleEndian::convertFrom<u16>(data + ofs + outIndex++ * 2,
-            found != pksm::internal::G4Chars.end()
-                ? pksm::internal::G4Values[std::distance(pksm::internal::G4Chars.begin(), found)]
-                : 0x0000);
+        LittleEndian::convertFrom<u16>(data + ofs + outIndex++ * 2, codepointToG4(codepoint));
 
         charIndex += size;
     }
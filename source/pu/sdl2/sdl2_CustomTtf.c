@@ -2243,6 +2243,25 @@ int TTF_GetFontKerningSize(TTF_Font* font, int prev_index, int index)
     return (delta.x >> 6);
 }
 
+int TTF_CppWrap_GetCharKerning(TTF_Font *font, Uint16 prev_ch, Uint16 ch)
+{
+    FT_UInt prev_index, index;
+    FT_Vector delta;
+
+    if ( !FT_HAS_KERNING( font->face ) || !font->kerning ) {
+        return 0;
+    }
+
+    prev_index = FT_Get_Char_Index( font->face, prev_ch );
+    index = FT_Get_Char_Index( font->face, ch );
+    if ( !prev_index || !index ) {
+        return 0;
+    }
+
+    FT_Get_Kerning( font->face, prev_index, index, ft_kerning_default, &delta );
+    return (delta.x >> 6);
+}
+
 void *TTF_CppWrap_GetCppPtrRef(TTF_Font *font)
 {
     return font->cpp_font_ref_ptr;
@@ -7,4 +7,11 @@ namespace pu::sdl2 {
         ui::render::DeleteTexture(this->tex);
     }
 
+    void TextureHandle::Reset(Texture tex) {
+        if(this->tex != tex) {
+            ui::render::DeleteTexture(this->tex);
+            this->tex = tex;
+        }
+    }
+
 }
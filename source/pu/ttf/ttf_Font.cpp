@@ -1,21 +1,125 @@
 #include <pu/ttf/ttf_Font.hpp>
 #include <pu/ui/render/render_Renderer.hpp>
 #include <pu/ui/render/render_SDL2.hpp>
+#include <algorithm>
+#include <unordered_map>
 
 namespace pu::ttf {
 
     namespace {
 
-        void FileBufferFontFaceDisposingFunction(void *ptr) {
-            if(ptr != nullptr) {
-                auto file_buf = reinterpret_cast<u8*>(ptr);
-                delete[] file_buf;
+        constexpr Uint16 UnknownChar = 0xFFFD;
+
+        std::unordered_map<std::string, std::weak_ptr<const FontFileBuffer>> g_SharedFontFiles;
+
+        // Decodes one UTF-8 character, like SDL_ttf only the BMP is supported
+        Uint16 DecodeUtf8Char(const std::string &str, size_t &pos) {
+            const auto lead = static_cast<u8>(str[pos++]);
+            if(lead < 0x80) {
+                return lead;
+            }
+
+            u32 ch = 0;
+            size_t extra = 0;
+            if((lead & 0xE0) == 0xC0) {
+                ch = lead & 0x1F;
+                extra = 1;
+            }
+            else if((lead & 0xF0) == 0xE0) {
+                ch = lead & 0x0F;
+                extra = 2;
+            }
+            else if((lead & 0xF8) == 0xF0) {
+                ch = lead & 0x07;
+                extra = 3;
             }
+            else {
+                return UnknownChar;
+            }
+
+            for(size_t i = 0; i < extra; i++) {
+                if((pos >= str.length()) || ((static_cast<u8>(str[pos]) & 0xC0) != 0x80)) {
+                    return UnknownChar;
+                }
+                ch = (ch << 6) | (static_cast<u8>(str[pos++]) & 0x3F);
+            }
+
+            return (ch > 0xFFFF) ? UnknownChar : static_cast<Uint16>(ch);
+        }
+
+        // Creates a transparent page texture. It is a render target so it can be cleared and grown on
+        // the GPU; glyphs are still uploaded with SDL_UpdateTexture.
+        sdl2::Texture CreateGlyphPageTexture(const i32 size, sdl2::Texture copy_from = nullptr) {
+            auto renderer = ui::render::GetMainRenderer();
+            auto tex = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET, size, size);
+            if(tex == nullptr) {
+                return nullptr;
+            }
+
+            // Glyphs may be rasterised in the middle of drawing a layer, so put back whatever was being drawn to
+            const auto prev_target = SDL_GetRenderTarget(renderer);
+            Uint8 r, g, b, a;
+            SDL_GetRenderDrawColor(renderer, &r, &g, &b, &a);
+            if(SDL_SetRenderTarget(renderer, tex) != 0) {
+                SDL_DestroyTexture(tex);
+                return nullptr;
+            }
+
+            // The padding between glyphs must be transparent
+            SDL_SetRenderDrawColor(renderer, 0, 0, 0, 0);
+            SDL_RenderClear(renderer);
+            if(copy_from != nullptr) {
+                // Copy the old page's pixels as they are, without blending
+                i32 copy_size = 0;
+                SDL_QueryTexture(copy_from, nullptr, nullptr, &copy_size, nullptr);
+                const SDL_Rect rect = { 0, 0, copy_size, copy_size };
+                SDL_SetTextureBlendMode(copy_from, SDL_BLENDMODE_NONE);
+                SDL_RenderCopy(renderer, copy_from, &rect, &rect);
+            }
+
+            SDL_SetRenderTarget(renderer, prev_target);
+            SDL_SetRenderDrawColor(renderer, r, g, b, a);
+            SDL_SetTextureBlendMode(tex, SDL_BLENDMODE_BLEND);
+            return tex;
         }
 
     }
 
+    std::shared_ptr<const FontFileBuffer> LoadSharedFontFile(const std::string &path) {
+        auto it = g_SharedFontFiles.find(path);
+        if(it != g_SharedFontFiles.end()) {
+            if(auto file_buf = it->second.lock()) {
+                return file_buf;
+            }
+        }
+
+        auto f = fopen(path.c_str(), "rb");
+        if(f == nullptr) {
+            return nullptr;
+        }
+
+        std::shared_ptr<FontFileBuffer> file_buf;
+        fseek(f, 0, SEEK_END);
+        const auto f_size = ftell(f);
+        rewind(f);
+        if(f_size > 0) {
+            file_buf = std::make_shared<FontFileBuffer>(f_size);
+            if(fread(file_buf->data(), 1, f_size, f) != static_cast<size_t>(f_size)) {
+                file_buf.reset();
+            }
+        }
+        fclose(f);
+
+        if(file_buf != nullptr) {
+            g_SharedFontFiles[path] = file_buf;
+        }
+        return file_buf;
+    }
+
     Font::~Font() {
+        for(auto &page : this->glyph_pages) {
+            ui::render::DeleteTexture(page.tex);
+        }
         for(auto &[idx, font] : this->font_faces) {
             font->Dispose();
         }
@@ -29,28 +133,25 @@ namespace pu::ttf {
     }
 
     i32 Font::LoadFromFile(const std::string &path) {
-        auto f = fopen(path.c_str(), "rb");
-        if(f) {
-            fseek(f, 0, SEEK_END);
-            const auto f_size = ftell(f);
-            rewind(f);
-            if(f_size > 0) {
-                auto font_buf = new u8[f_size]();
-                fread(font_buf, 1, f_size, f);
-                fclose(f);
-                return this->LoadFromMemory(font_buf, f_size, FileBufferFontFaceDisposingFunction);
-            }
-            fclose(f);
+        auto file_buf = LoadSharedFontFile(path);
+        if(file_buf == nullptr) {
+            return InvalidFontFaceIndex;
         }
 
-        return InvalidFontFaceIndex;
+        // FreeType only reads the buffer, so every size can open its face from the same memory
+        const auto idx = this->LoadFromMemory(const_cast<u8*>(file_buf->data()), file_buf->size(), EmptyFontFaceDisposingFunction);
+        this->font_faces.back().second->file_buf = std::move(file_buf);
+        return idx;
     }
 
     void Font::Unload(const i32 font_idx) {
         u32 i = 0;
         for(auto &[idx, font]: this->font_faces) {
             if(idx == font_idx) {
+                font->Dispose();
                 this->font_faces.erase(this->font_faces.begin() + i);
+                // Cached glyphs may come from the removed face, already laid out text keeps working since pages are kept
+                this->glyphs.clear();
                 break;
             }
             i++;
@@ -59,8 +160,9 @@ namespace pu::ttf {
 
     sdl2::Font Font::FindValidFontFor(const Uint16 ch) {
         for(const auto &[idx, font] : this->font_faces) {
-            if(TTF_GlyphIsProvided(font->font, ch)) {
-                return font->font;
+            auto face = font->Get();
+            if((face != nullptr) && TTF_GlyphIsProvided(face, ch)) {
+                return face;
             }
         }
 
@@ -118,6 +220,201 @@ namespace pu::ttf {
         }
     }
 
+    const Font::Glyph *Font::FindGlyph(const Uint16 ch) {
+        auto it = this->glyphs.find(ch);
+        if(it != this->glyphs.end()) {
+            return &it->second;
+        }
+
+        auto face = this->FindValidFontFor(ch);
+        if(face == nullptr) {
+            face = this->TryGetFirstFont();
+            if(face == nullptr) {
+                return nullptr;
+            }
+        }
+
+        Glyph glyph = { face, 0, { 0, 0, 0, 0 }, 0, 0, 0 };
+        i32 min_x = 0;
+        i32 min_y = 0;
+        i32 max_y = 0;
+        i32 advance = 0;
+        if(TTF_GlyphMetrics(face, ch, &min_x, nullptr, &min_y, &max_y, &advance) == 0) {
+            glyph.advance = advance;
+            // SDL_ttf shifts a glyph extending left of its origin into the surface
+            glyph.offset_x = std::min(min_x, 0);
+
+            // Rendered in white so any colour can be applied when drawing
+            auto srf = TTF_RenderGlyph_Blended(face, ch, { 0xFF, 0xFF, 0xFF, 0xFF });
+            if(srf != nullptr) {
+                // The surface spans the whole line height, only keep the rows the glyph covers
+                const auto ascent = TTF_FontAscent(face);
+                const auto top = std::max(ascent - max_y, 0);
+                const auto bottom = std::min(ascent - min_y, srf->h);
+                if((bottom > top) && (srf->w > 0) && this->AllocateGlyphRect(srf->w, bottom - top, glyph.page, glyph.src)) {
+                    const auto pixels = reinterpret_cast<const u8*>(srf->pixels) + (top * srf->pitch);
+                    SDL_UpdateTexture(this->glyph_pages.at(glyph.page).tex, &glyph.src, pixels, srf->pitch);
+                    glyph.offset_y = top;
+                }
+                SDL_FreeSurface(srf);
+            }
+        }
+
+        return &this->glyphs.emplace(ch, glyph).first->second;
+    }
+
+    bool Font::AllocateGlyphRect(const i32 w, const i32 h, u32 &out_page, SDL_Rect &out_rect) {
+        // Keep a transparent pixel between glyphs so filtering never bleeds a neighbour in
+        const auto padded_w = w + 1;
+        const auto padded_h = h + 1;
+
+        if(!this->glyph_pages.empty()) {
+            auto &page = this->glyph_pages.back();
+            while(true) {
+                // On the current shelf, or else on a new one below it
+                auto x = page.shelf_x;
+                auto y = page.shelf_y;
+                auto shelf_h = page.shelf_h;
+                if((x + padded_w) > page.size) {
+                    x = 0;
+                    y += shelf_h;
+                    shelf_h = 0;
+                }
+                if(((x + padded_w) <= page.size) && ((y + padded_h) <= page.size)) {
+                    out_page = static_cast<u32>(this->glyph_pages.size() - 1);
+                    out_rect = { x, y, w, h };
+                    page.shelf_x = x + padded_w;
+                    page.shelf_y = y;
+                    page.shelf_h = std::max(shelf_h, padded_h);
+                    return true;
+                }
+                if((page.size >= GlyphPageMaxSize) || !this->GrowGlyphPage(page)) {
+                    break;
+                }
+            }
+        }
+
+        const auto size = std::max({ GlyphPageInitialSize, padded_w, padded_h });
+        auto tex = CreateGlyphPageTexture(size);
+        if(tex == nullptr) {
+            return false;
+        }
+
+        this->glyph_pages.push_back({ tex, size, padded_w, 0, padded_h });
+        out_page = static_cast<u32>(this->glyph_pages.size() - 1);
+        out_rect = { 0, 0, w, h };
+        return true;
+    }
+
+    bool Font::GrowGlyphPage(GlyphPage &page) {
+        // Glyphs keep their positions, so layouts made before growing stay valid
+        const auto size = std::min(page.size * 2, GlyphPageMaxSize);
+        auto tex = CreateGlyphPageTexture(size, page.tex);
+        if(tex == nullptr) {
+            return false;
+        }
+
+        ui::render::DeleteTexture(page.tex);
+        page.tex = tex;
+        page.size = size;
+        return true;
+    }
+
+    TextLayout Font::LayoutText(const std::string &str, const u32 wrap_width) {
+        TextLayout layout;
+        auto font = this->TryGetFirstFont();
+        if((font == nullptr) || str.empty()) {
+            return layout;
+        }
+
+        const auto max_line_width = static_cast<i32>((wrap_width > 0) ? wrap_width : ui::render::GetDimensions().first);
+        const auto line_height = TTF_FontHeight(font);
+        const auto line_advance = line_height + LineSpacing;
+
+        i32 pen_x = 0;
+        i32 line_y = 0;
+        i32 line_width = 0;
+        i32 line_count = 1;
+        Uint16 prev_ch = 0;
+        sdl2::Font prev_face = nullptr;
+
+        // The current line can be broken after its last space, moving the quads laid out since then
+        auto break_quad = layout.quads.max_size();
+        i32 break_x = 0;
+        i32 break_line_width = 0;
+
+        size_t pos = 0;
+        while(pos < str.length()) {
+            const auto ch = DecodeUtf8Char(str, pos);
+            if(ch == '\r') {
+                continue;
+            }
+            if(ch == '\n') {
+                layout.width = std::max(layout.width, line_width);
+                pen_x = 0;
+                line_y += line_advance;
+                line_width = 0;
+                line_count++;
+                prev_ch = 0;
+                prev_face = nullptr;
+                break_quad = layout.quads.max_size();
+                continue;
+            }
+
+            auto glyph = this->FindGlyph(ch);
+            if(glyph == nullptr) {
+                continue;
+            }
+
+            if((prev_ch != 0) && (prev_face == glyph->face)) {
+                pen_x += TTF_CppWrap_GetCharKerning(glyph->face, prev_ch, ch);
+            }
+
+            if((ch != ' ') && ((pen_x + glyph->advance) > max_line_width) && (break_quad != layout.quads.max_size())) {
+                layout.width = std::max(layout.width, break_line_width);
+                line_y += line_advance;
+                line_count++;
+                line_width = 0;
+                for(auto i = break_quad; i < layout.quads.size(); i++) {
+                    auto &quad = layout.quads.at(i);
+                    quad.dst.x -= break_x;
+                    quad.dst.y += line_advance;
+                    line_width = std::max(line_width, quad.dst.x + quad.dst.w);
+                }
+                pen_x -= break_x;
+                line_width = std::max(line_width, pen_x);
+                break_quad = layout.quads.max_size();
+            }
+
+            if((pen_x == 0) && (glyph->offset_x < 0)) {
+                pen_x = -glyph->offset_x;
+            }
+
+            const auto width_before = line_width;
+            if(glyph->src.w > 0) {
+                const SDL_Rect dst = { pen_x + glyph->offset_x, line_y + glyph->offset_y, glyph->src.w, glyph->src.h };
+                layout.quads.push_back({ glyph->page, glyph->src, dst });
+                line_width = std::max(line_width, dst.x + dst.w);
+            }
+            pen_x += glyph->advance;
+            line_width = std::max(line_width, pen_x);
+
+            if(ch == ' ') {
+                break_quad = layout.quads.size();
+                break_x = pen_x;
+                break_line_width = width_before;
+            }
+            prev_ch = ch;
+            prev_face = glyph->face;
+        }
+
+        layout.width = std::max(layout.width, line_width);
+        if(layout.width > 0) {
+            layout.height = (line_count * line_height) + ((line_count - 1) * LineSpacing);
+        }
+        return layout;
+    }
+
 }
 
 extern "C" {
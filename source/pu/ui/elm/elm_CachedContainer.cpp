@@ -0,0 +1,98 @@
+#include <pu/ui/elm/elm_CachedContainer.hpp>
+
+namespace pu::ui::elm {
+
+    CachedContainer::~CachedContainer() {
+        render::DeleteTexture(this->cache_tex);
+    }
+
+    CachedContainer::ElementState CachedContainer::GetElementState(Element::Ref &elem) {
+        return { elem->GetProcessedX(), elem->GetProcessedY(), elem->GetWidth(), elem->GetHeight(), elem->IsVisible() };
+    }
+
+    bool CachedContainer::CacheOutdated() {
+        if(!this->cache_valid || (this->cache_tex == nullptr) || (this->elem_states.size() != this->elems.size())) {
+            return true;
+        }
+
+        for(u32 i = 0; i < this->elems.size(); i++) {
+            auto &elem = this->elems.at(i);
+            if(elem->IsDirty() || !(GetElementState(elem) == this->elem_states.at(i))) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    void CachedContainer::RenderElements(render::Renderer::Ref &drawer) {
+        this->elem_states.clear();
+        for(auto &elem: this->elems) {
+            if(elem->IsVisible()) {
+                elem->OnRender(drawer, elem->GetProcessedX(), elem->GetProcessedY());
+            }
+            elem->ClearDirty();
+            this->elem_states.push_back(GetElementState(elem));
+        }
+    }
+
+    bool CachedContainer::RedrawCache(render::Renderer::Ref &drawer, const i32 x, const i32 y) {
+        if(this->cache_tex == nullptr) {
+            this->cache_tex = SDL_CreateTexture(render::GetMainRenderer(), SDL_PIXELFORMAT_RGBA8888, SDL_TEXTUREACCESS_TARGET, this->w, this->h);
+            if(this->cache_tex == nullptr) {
+                return false;
+            }
+        }
+
+        if(!drawer->BeginLayer(this->cache_tex, x, y)) {
+            return false;
+        }
+        this->RenderElements(drawer);
+        drawer->EndLayer();
+
+        this->cache_valid = true;
+        return true;
+    }
+
+    void CachedContainer::SetWidth(const i32 width) {
+        if(this->w != width) {
+            this->w = width;
+            render::DeleteTexture(this->cache_tex);
+            this->Invalidate();
+        }
+    }
+
+    void CachedContainer::SetHeight(const i32 height) {
+        if(this->h != height) {
+            this->h = height;
+            render::DeleteTexture(this->cache_tex);
+            this->Invalidate();
+        }
+    }
+
+    bool CachedContainer::IsDirty() {
+        return this->dirty || this->CacheOutdated();
+    }
+
+    void CachedContainer::OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) {
+        if((this->w <= 0) || (this->h <= 0)) {
+            return;
+        }
+
+        if(this->CacheOutdated() && !this->RedrawCache(drawer, x, y)) {
+            // Without a render target there is nothing to cache into, so just draw everything every frame
+            this->RenderElements(drawer);
+            return;
+        }
+
+        drawer->RenderLayer(this->cache_tex, x, y);
+    }
+
+    void CachedContainer::OnInput(const u64 keys_down, const u64 keys_up, const u64 keys_held, const TouchPoint touch_pos) {
+        for(auto &elem: this->elems) {
+            if(elem->IsVisible()) {
+                elem->OnInput(keys_down, keys_up, keys_held, touch_pos);
+            }
+        }
+    }
+
+}
@@ -7,21 +7,35 @@ namespace pu::ui::elm {
         this->x = x;
         this->y = y;
         this->img_tex = nullptr;
+        this->rendered_tex = nullptr;
         this->rend_opts = render::TextureRenderOptions::Default();
         this->SetImage(image);
     }
 
     void Image::SetImage(sdl2::TextureHandle::Ref image) {
         this->img_tex = image;
-        if(this->img_tex != nullptr) {
+        // Empty handles keep the current size, the texture's own size is used if none was set
+        if((this->img_tex != nullptr) && (this->img_tex->Get() != nullptr)) {
             this->rend_opts.width = render::GetTextureWidth(this->img_tex->Get());
             this->rend_opts.height = render::GetTextureHeight(this->img_tex->Get());
         }
+        this->MarkDirty();
+    }
+
+    bool Image::IsDirty() {
+        if(Element::IsDirty()) {
+            return true;
+        }
+
+        const auto cur_tex = (this->img_tex != nullptr) ? this->img_tex->Get() : nullptr;
+        return cur_tex != this->rendered_tex;
     }
 
     void Image::OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) {
+        this->rendered_tex = nullptr;
         if(this->img_tex != nullptr) {
-            drawer->RenderTexture(this->img_tex->Get(), x, y, this->rend_opts);
+            this->rendered_tex = this->img_tex->Get();
+            drawer->RenderTexture(this->rendered_tex, x, y, this->rend_opts);
         }
     }
 
@@ -13,6 +13,7 @@ namespace pu::ui::elm {
         else {
             this->val = progress;
         }
+        this->MarkDirty();
     }
 
     void ProgressBar::OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) {
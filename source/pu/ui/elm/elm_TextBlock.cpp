@@ -6,41 +6,51 @@ namespace pu::ui::elm {
         this->x = x;
         this->y = y;
         this->clr = DefaultColor;
-        this->text_tex = nullptr;
-        this->fnt_name = GetDefaultFont(DefaultFontSize::MediumLarge);
-        this->SetText(text);
+        this->text = text;
+        this->SetFont(GetDefaultFont(DefaultFontSize::MediumLarge));
     }
 
-    TextBlock::~TextBlock() {
-        render::DeleteTexture(this->text_tex);
+    void TextBlock::UpdateLayout() {
+        if(this->fnt == nullptr) {
+            this->fnt = render::GetFont(this->fnt_name);
+        }
+
+        if(this->fnt != nullptr) {
+            this->layout = this->fnt->LayoutText(this->text);
+        }
+        else {
+            this->layout = {};
+        }
+        this->MarkDirty();
     }
 
     i32 TextBlock::GetWidth() {
-        return render::GetTextureWidth(this->text_tex);
+        return this->layout.width;
     }
 
     i32 TextBlock::GetHeight() {
-        return render::GetTextureHeight(this->text_tex);
+        return this->layout.height;
     }
 
     void TextBlock::SetText(const std::string &text) {
+        if((text == this->text) && (this->fnt != nullptr)) {
+            return;
+        }
+
         this->text = text;
-        render::DeleteTexture(this->text_tex);
-        this->text_tex = render::RenderText(this->fnt_name, text, this->clr);
+        this->UpdateLayout();
     }
 
     void TextBlock::SetFont(const std::string &font_name) {
         this->fnt_name = font_name;
-        this->SetText(this->text);
-    }
-
-    void TextBlock::SetColor(const Color clr) {
-        this->clr = clr;
-        this->SetText(this->text);
+        this->fnt = render::GetFont(font_name);
+        this->UpdateLayout();
     }
 
     void TextBlock::OnRender(render::Renderer::Ref &drawer, const i32 x, const i32 y) {
-        drawer->RenderTexture(this->text_tex, x, y);
+        if(this->fnt != nullptr) {
+            drawer->RenderTextLayout(*this->fnt, this->layout, this->clr, x, y);
+        }
     }
 
 }
@@ -1,4 +1,7 @@
+#include <algorithm>
+#include <cmath>
 #include <pu/ui/render/render_Renderer.hpp>
+#include <thread>
 
 namespace pu::ui::render {
 
@@ -9,6 +12,10 @@ sdl2::Renderer g_Renderer = nullptr;
 sdl2::Window g_Window = nullptr;
 sdl2::Surface g_WindowSurface = nullptr;
 
+// Whose batched shapes GetMainRenderer flushes, and the only thread it may do so from
+Renderer* g_BatchingRenderer = nullptr;
+std::thread::id g_RenderThreadId;
+
 // Global font object
 std::vector<std::pair<std::string, std::shared_ptr<ttf::Font>>> g_FontTable;
 
@@ -22,6 +29,59 @@ inline bool ExistsFont(const std::string& font_name) {
     return false;
 }
 
+inline bool IsUtf8Continuation(const char ch) {
+    return (static_cast<u8>(ch) & 0xC0) == 0x80;
+}
+
+// Dimensions of the texture Font::RenderText produces, measured from glyph metrics without rendering
+std::pair<i32, i32> MeasureRenderedText(ttf::Font& font, const std::string& text) {
+    const auto [w, h] = font.GetTextDimensions(text);
+    i32 line_count = 1;
+    for (size_t i = 0; (i + 1) < text.length(); i++) {
+        if (text[i] == '\n') {
+            line_count++;
+        }
+    }
+    return {static_cast<i32>(w), static_cast<i32>(h) + (line_count - 1) * ttf::Font::LineSpacing};
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+// Smooth enough for the corner sizes used in the UI without producing needlessly many triangles
+constexpr i32 MaxCornerSegments = 16;
+
+inline i32 GetCornerSegments(const i32 radius) {
+    return std::clamp(radius / 2, 1, MaxCornerSegments);
+}
+
+// Points around a rounded rectangle, clockwise from the top left corner. The number of points only depends on
+// segments, so the outer and inner edges of a border pair up even when the inner radius is 0.
+void AppendRoundedRectanglePoints(
+    std::vector<SDL_FPoint>& points,
+    const float x,
+    const float y,
+    const float width,
+    const float height,
+    const float radius,
+    const i32 segments
+) {
+    const SDL_FPoint centers[] = {
+        {x + radius, y + radius},
+        {x + width - radius, y + radius},
+        {x + width - radius, y + height - radius},
+        {x + radius, y + height - radius}
+    };
+    for (u32 corner = 0; corner < 4; corner++) {
+        const auto start_angle = static_cast<float>(M_PI) * (1.0f + (0.5f * static_cast<float>(corner)));
+        for (i32 i = 0; i <= segments; i++) {
+            const auto angle = start_angle + ((static_cast<float>(M_PI) * 0.5f * static_cast<float>(i)) / segments);
+            points.push_back(
+                {centers[corner].x + (radius * std::cos(angle)), centers[corner].y + (radius * std::sin(angle))}
+            );
+        }
+    }
+}
+#endif
+
 }  // namespace
 
 void Renderer::Initialize() {
@@ -80,6 +140,8 @@ void Renderer::Initialize() {
             Mix_OpenAudio(44100, MIX_DEFAULT_FORMAT, MIX_DEFAULT_CHANNELS, 4096);
         }
 
+        g_BatchingRenderer = this;
+        g_RenderThreadId = std::this_thread::get_id();
         this->initialized = true;
         this->base_a = TextureRenderOptions::NoAlpha;
         this->base_x = 0;
@@ -108,6 +170,7 @@ void Renderer::Finalize() {
         if (this->ok_romfs) {
             romfsExit();
         }
+        g_BatchingRenderer = nullptr;
         SDL_DestroyRenderer(g_Renderer);
         g_Renderer = nullptr;
         SDL_FreeSurface(g_WindowSurface);
@@ -122,25 +185,53 @@ void Renderer::Finalize() {
 void Renderer::InitializeRender(const Color clr) {
     SDL_SetRenderDrawColor(g_Renderer, clr.r, clr.g, clr.b, clr.a);
     SDL_RenderClear(g_Renderer);
+    this->frame_draw_calls = 0;
 }
 
 void Renderer::FinalizeRender() {
+    this->FlushShapes();
+    this->last_frame_draw_calls = this->frame_draw_calls;
     SDL_RenderPresent(g_Renderer);
 }
 
 void Renderer::RenderTexture(sdl2::Texture texture, const i32 x, const i32 y, const TextureRenderOptions opts) {
+    this->RenderTextureRegion(texture, nullptr, x, y, opts);
+}
+
+void Renderer::RenderTexture(
+    sdl2::Texture texture,
+    const SDL_Rect& src_rect,
+    const i32 x,
+    const i32 y,
+    const TextureRenderOptions opts
+) {
+    this->RenderTextureRegion(texture, &src_rect, x, y, opts);
+}
+
+void Renderer::RenderTextureRegion(
+    sdl2::Texture texture,
+    const SDL_Rect* src_rect,
+    const i32 x,
+    const i32 y,
+    const TextureRenderOptions opts
+) {
     if (texture == nullptr) {
         return;
     }
+    this->FlushShapes();
 
     SDL_Rect pos = {.x = x + this->base_x, .y = y + this->base_y};
     if (opts.width != TextureRenderOptions::NoWidth) {
         pos.w = opts.width;
+    } else if (src_rect != nullptr) {
+        pos.w = src_rect->w;
     } else {
         SDL_QueryTexture(texture, nullptr, nullptr, &pos.w, nullptr);
     }
     if (opts.height != TextureRenderOptions::NoHeight) {
         pos.h = opts.height;
+    } else if (src_rect != nullptr) {
+        pos.h = src_rect->h;
     } else {
         SDL_QueryTexture(texture, nullptr, nullptr, nullptr, &pos.h);
     }
@@ -158,7 +249,8 @@ void Renderer::RenderTexture(sdl2::Texture texture, const i32 x, const i32 y, co
         SetAlphaValue(texture, static_cast<u8>(this->base_a));
     }
 
-    SDL_RenderCopyEx(g_Renderer, texture, nullptr, &pos, angle, nullptr, SDL_FLIP_NONE);
+    SDL_RenderCopyEx(g_Renderer, texture, src_rect, &pos, angle, nullptr, SDL_FLIP_NONE);
+    this->CountDrawCalls(1);
 
     if (has_alpha_mod || (this->base_a >= 0)) {
         // Aka unset alpha value, needed if the same texture is rendered several times with different alphas
@@ -167,15 +259,43 @@ void Renderer::RenderTexture(sdl2::Texture texture, const i32 x, const i32 y, co
 }
 
 void Renderer::RenderRectangle(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_batching) {
+        if ((width <= 0) || (height <= 0)) {
+            return;
+        }
+
+        // Same pixels as SDL_RenderDrawRect
+        this->BatchRectangle(clr, x, y, width, 1);
+        if (height > 1) {
+            this->BatchRectangle(clr, x, y + height - 1, width, 1);
+        }
+        if (height > 2) {
+            this->BatchRectangle(clr, x, y + 1, 1, height - 2);
+            if (width > 1) {
+                this->BatchRectangle(clr, x + width - 1, y + 1, 1, height - 2);
+            }
+        }
+        return;
+    }
+#endif
     const SDL_Rect rect = {.x = x + this->base_x, .y = y + this->base_y, .w = width, .h = height};
     SDL_SetRenderDrawColor(g_Renderer, clr.r, clr.g, clr.b, this->GetActualAlpha(clr.a));
     SDL_RenderDrawRect(g_Renderer, &rect);
+    this->CountDrawCalls(1);
 }
 
 void Renderer::RenderRectangleFill(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height) {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_batching) {
+        this->BatchRectangle(clr, x, y, width, height);
+        return;
+    }
+#endif
     const SDL_Rect rect = {.x = x + this->base_x, .y = y + this->base_y, .w = width, .h = height};
     SDL_SetRenderDrawColor(g_Renderer, clr.r, clr.g, clr.b, this->GetActualAlpha(clr.a));
     SDL_RenderFillRect(g_Renderer, &rect);
+    this->CountDrawCalls(1);
 }
 
 void Renderer::RenderRoundedRectangle(
@@ -194,6 +314,12 @@ void Renderer::RenderRoundedRectangle(
         proper_radius = height / 2;
     }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_batching) {
+        this->RenderRoundedRectangleBorder(clr, x, y, width, height, proper_radius, 1);
+        return;
+    }
+#endif
     roundedRectangleRGBA(
         g_Renderer,
         x + this->base_x,
@@ -207,6 +333,7 @@ void Renderer::RenderRoundedRectangle(
         this->GetActualAlpha(clr.a)
     );
     SDL_SetRenderDrawBlendMode(g_Renderer, SDL_BLENDMODE_BLEND);
+    this->CountDrawCalls(1);
 }
 
 void Renderer::RenderRoundedRectangleFill(
@@ -225,6 +352,17 @@ void Renderer::RenderRoundedRectangleFill(
         proper_radius = height / 2;
     }
 
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_batching) {
+        // SDL2_gfx includes the far edge, so its shapes cover one pixel more than their size. Keep that so nothing
+        // moves.
+        if ((width < 0) || (height < 0)) {
+            return;
+        }
+        this->BatchShape(this->GetShapeGeometry({width + 1, height + 1, proper_radius, 0}), clr, x, y);
+        return;
+    }
+#endif
     roundedBoxRGBA(
         g_Renderer,
         x + this->base_x,
@@ -238,9 +376,48 @@ void Renderer::RenderRoundedRectangleFill(
         this->GetActualAlpha(clr.a)
     );
     SDL_SetRenderDrawBlendMode(g_Renderer, SDL_BLENDMODE_BLEND);
+    this->CountDrawCalls(1);
+}
+
+void Renderer::RenderRoundedRectangleBorder(
+    const Color clr,
+    const i32 x,
+    const i32 y,
+    const i32 width,
+    const i32 height,
+    const i32 radius,
+    const i32 border_width
+) {
+    if ((width < 0) || (height < 0) || (border_width <= 0)) {
+        return;
+    }
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_batching) {
+        // One pixel larger than the size, like the other rounded shapes
+        this->BatchShape(
+            this->GetShapeGeometry({width + 1, height + 1, std::max(radius, 0), border_width}),
+            clr,
+            x,
+            y
+        );
+        return;
+    }
+#endif
+    for (i32 i = 0; i < border_width; i++) {
+        this->RenderRoundedRectangle(
+            clr,
+            x + i,
+            y + i,
+            width - (2 * i),
+            height - (2 * i),
+            (radius > i) ? (radius - i) : 0
+        );
+    }
 }
 
 void Renderer::RenderCircle(const Color clr, const i32 x, const i32 y, const i32 radius) {
+    this->FlushShapes();
     circleRGBA(
         g_Renderer,
         x + this->base_x,
@@ -261,9 +438,11 @@ void Renderer::RenderCircle(const Color clr, const i32 x, const i32 y, const i32
         clr.b,
         this->GetActualAlpha(clr.a)
     );
+    this->CountDrawCalls(2);
 }
 
 void Renderer::RenderCircleFill(const Color clr, const i32 x, const i32 y, const i32 radius) {
+    this->FlushShapes();
     filledCircleRGBA(
         g_Renderer,
         x + this->base_x,
@@ -284,9 +463,11 @@ void Renderer::RenderCircleFill(const Color clr, const i32 x, const i32 y, const
         clr.b,
         this->GetActualAlpha(clr.a)
     );
+    this->CountDrawCalls(2);
 }
 
 void Renderer::RenderEllipse(const Color clr, const i32 x, const i32 y, const i32 rx, const i32 ry) {
+    this->FlushShapes();
     ellipseRGBA(
         g_Renderer,
         x + this->base_x,
@@ -309,9 +490,11 @@ void Renderer::RenderEllipse(const Color clr, const i32 x, const i32 y, const i3
         clr.b,
         this->GetActualAlpha(clr.a)
     );
+    this->CountDrawCalls(2);
 }
 
 void Renderer::RenderEllipseFill(const Color clr, const i32 x, const i32 y, const i32 rx, const i32 ry) {
+    this->FlushShapes();
     filledEllipseRGBA(
         g_Renderer,
         x + this->base_x,
@@ -334,6 +517,7 @@ void Renderer::RenderEllipseFill(const Color clr, const i32 x, const i32 y, cons
         clr.b,
         this->GetActualAlpha(clr.a)
     );
+    this->CountDrawCalls(2);
 }
 
 void Renderer::RenderShadowSimple(
@@ -350,7 +534,7 @@ void Renderer::RenderShadowSimple(
     auto shadow_y = y;
     for (auto cur_a = base_alpha; cur_a > 0; cur_a -= (180 / height)) {
         const Color shadow_clr = {130, 130, 130, static_cast<u8>(cur_a * (main_alpha / 0xFF))};
-        this->RenderRectangleFill(shadow_clr, shadow_x + this->base_x, shadow_y + this->base_y, shadow_width, 1);
+        this->RenderRectangleFill(shadow_clr, shadow_x, shadow_y, shadow_width, 1);
         if (crop) {
             shadow_width -= 2;
             shadow_x++;
@@ -360,7 +544,281 @@ void Renderer::RenderShadowSimple(
     }
 }
 
+void Renderer::RenderTextLayout(
+    ttf::Font& font,
+    const ttf::TextLayout& layout,
+    const Color clr,
+    const i32 x,
+    const i32 y
+) {
+    if (layout.quads.empty()) {
+        return;
+    }
+    this->FlushShapes();
+
+    // Glyphs are white in the atlas, the colour is applied per draw. A base alpha fades the text like it fades textures.
+    auto alpha = clr.a;
+    if (this->base_a >= 0) {
+        alpha = static_cast<u8>((static_cast<u32>(clr.a) * static_cast<u32>(this->base_a)) / 0xFF);
+    }
+    const auto origin_x = x + this->base_x;
+    const auto origin_y = y + this->base_y;
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    const SDL_Color vertex_clr = {clr.r, clr.g, clr.b, alpha};
+    auto cur_page = layout.quads.front().page;
+    auto cur_tex = font.GetGlyphPageTexture(cur_page);
+    auto tex_w = 0;
+    auto tex_h = 0;
+    SDL_QueryTexture(cur_tex, nullptr, nullptr, &tex_w, &tex_h);
+
+    for (const auto& quad : layout.quads) {
+        if (quad.page != cur_page) {
+            this->FlushTextBatch(cur_tex);
+            cur_page = quad.page;
+            cur_tex = font.GetGlyphPageTexture(cur_page);
+            SDL_QueryTexture(cur_tex, nullptr, nullptr, &tex_w, &tex_h);
+        }
+        if ((tex_w <= 0) || (tex_h <= 0)) {
+            continue;
+        }
+
+        const auto left = static_cast<float>(origin_x + quad.dst.x);
+        const auto top = static_cast<float>(origin_y + quad.dst.y);
+        const auto right = left + static_cast<float>(quad.dst.w);
+        const auto bottom = top + static_cast<float>(quad.dst.h);
+        const auto u0 = static_cast<float>(quad.src.x) / static_cast<float>(tex_w);
+        const auto v0 = static_cast<float>(quad.src.y) / static_cast<float>(tex_h);
+        const auto u1 = static_cast<float>(quad.src.x + quad.src.w) / static_cast<float>(tex_w);
+        const auto v1 = static_cast<float>(quad.src.y + quad.src.h) / static_cast<float>(tex_h);
+
+        const auto base_idx = static_cast<int>(this->text_vertices.size());
+        this->text_vertices.push_back({{left, top}, vertex_clr, {u0, v0}});
+        this->text_vertices.push_back({{right, top}, vertex_clr, {u1, v0}});
+        this->text_vertices.push_back({{right, bottom}, vertex_clr, {u1, v1}});
+        this->text_vertices.push_back({{left, bottom}, vertex_clr, {u0, v1}});
+        for (const auto idx_offset : {0, 1, 2, 0, 2, 3}) {
+            this->text_indices.push_back(base_idx + idx_offset);
+        }
+    }
+    this->FlushTextBatch(cur_tex);
+#else
+    for (const auto& quad : layout.quads) {
+        auto page_tex = font.GetGlyphPageTexture(quad.page);
+        if (page_tex == nullptr) {
+            continue;
+        }
+
+        const SDL_Rect dst = {origin_x + quad.dst.x, origin_y + quad.dst.y, quad.dst.w, quad.dst.h};
+        SDL_SetTextureColorMod(page_tex, clr.r, clr.g, clr.b);
+        SDL_SetTextureAlphaMod(page_tex, alpha);
+        SDL_RenderCopy(g_Renderer, page_tex, &quad.src, &dst);
+        this->CountDrawCalls(1);
+    }
+#endif
+}
+
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+void Renderer::FlushTextBatch(sdl2::Texture page_tex) {
+    if ((page_tex != nullptr) && !this->text_indices.empty()) {
+        SDL_RenderGeometry(
+            g_Renderer,
+            page_tex,
+            this->text_vertices.data(),
+            static_cast<int>(this->text_vertices.size()),
+            this->text_indices.data(),
+            static_cast<int>(this->text_indices.size())
+        );
+        this->CountDrawCalls(1);
+    }
+    this->text_vertices.clear();
+    this->text_indices.clear();
+}
+
+size_t Renderer::ShapeKeyHash::operator()(const ShapeKey& key) const {
+    size_t hash = std::hash<i32>()(key.width);
+    for (const auto value : {key.height, key.radius, key.border_width}) {
+        hash = (hash * 31) + std::hash<i32>()(value);
+    }
+    return hash;
+}
+
+const Renderer::ShapeGeometry& Renderer::GetShapeGeometry(const ShapeKey& key) {
+    auto it = this->shape_cache.find(key);
+    if (it != this->shape_cache.end()) {
+        return it->second;
+    }
+
+    // Shapes that animate their size could otherwise grow this forever
+    if (this->shape_cache.size() >= 256) {
+        this->shape_cache.clear();
+    }
+
+    ShapeGeometry geometry;
+    const auto width = static_cast<float>(key.width);
+    const auto height = static_cast<float>(key.height);
+    const auto radius = static_cast<float>(std::min({key.radius, key.width / 2, key.height / 2}));
+    const auto segments = GetCornerSegments(static_cast<i32>(radius));
+    AppendRoundedRectanglePoints(geometry.points, 0.0f, 0.0f, width, height, radius, segments);
+    const auto point_count = static_cast<int>(geometry.points.size());
+
+    if ((key.border_width == 0) || ((2 * key.border_width) >= std::min(key.width, key.height))) {
+        // A fan from the centre, rounded rectangles being convex
+        geometry.points.push_back({width / 2.0f, height / 2.0f});
+        for (int i = 0; i < point_count; i++) {
+            for (const auto idx : {point_count, i, (i + 1) % point_count}) {
+                geometry.indices.push_back(idx);
+            }
+        }
+    } else {
+        // A strip between the outer edge and the inner one
+        const auto border = static_cast<float>(key.border_width);
+        AppendRoundedRectanglePoints(
+            geometry.points,
+            border,
+            border,
+            width - (2.0f * border),
+            height - (2.0f * border),
+            std::max(radius - border, 0.0f),
+            segments
+        );
+        for (int i = 0; i < point_count; i++) {
+            const auto next = (i + 1) % point_count;
+            for (const auto idx : {i, next, point_count + i, point_count + i, next, point_count + next}) {
+                geometry.indices.push_back(idx);
+            }
+        }
+    }
+
+    return this->shape_cache.emplace(key, std::move(geometry)).first->second;
+}
+
+void Renderer::BatchShape(const ShapeGeometry& geometry, const Color clr, const i32 x, const i32 y) {
+    const SDL_Color vertex_clr = {clr.r, clr.g, clr.b, this->GetActualAlpha(clr.a)};
+    const auto origin_x = static_cast<float>(x + this->base_x);
+    const auto origin_y = static_cast<float>(y + this->base_y);
+    const auto base_idx = static_cast<int>(this->shape_vertices.size());
+
+    for (const auto& point : geometry.points) {
+        this->shape_vertices.push_back({{origin_x + point.x, origin_y + point.y}, vertex_clr, {0.0f, 0.0f}});
+    }
+    for (const auto idx : geometry.indices) {
+        this->shape_indices.push_back(base_idx + idx);
+    }
+}
+
+void Renderer::BatchRectangle(const Color clr, const i32 x, const i32 y, const i32 width, const i32 height) {
+    if ((width <= 0) || (height <= 0)) {
+        return;
+    }
+
+    const SDL_Color vertex_clr = {clr.r, clr.g, clr.b, this->GetActualAlpha(clr.a)};
+    const auto left = static_cast<float>(x + this->base_x);
+    const auto top = static_cast<float>(y + this->base_y);
+    const auto right = left + static_cast<float>(width);
+    const auto bottom = top + static_cast<float>(height);
+    const auto base_idx = static_cast<int>(this->shape_vertices.size());
+
+    this->shape_vertices.push_back({{left, top}, vertex_clr, {0.0f, 0.0f}});
+    this->shape_vertices.push_back({{right, top}, vertex_clr, {0.0f, 0.0f}});
+    this->shape_vertices.push_back({{right, bottom}, vertex_clr, {0.0f, 0.0f}});
+    this->shape_vertices.push_back({{left, bottom}, vertex_clr, {0.0f, 0.0f}});
+    for (const auto idx_offset : {0, 1, 2, 0, 2, 3}) {
+        this->shape_indices.push_back(base_idx + idx_offset);
+    }
+}
+#endif
+
+void Renderer::FlushShapes() {
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    if (this->shape_indices.empty()) {
+        return;
+    }
+
+    // Untextured geometry blends with the draw blend mode, which code drawing straight to SDL may have changed
+    SDL_SetRenderDrawBlendMode(g_Renderer, SDL_BLENDMODE_BLEND);
+    SDL_RenderGeometry(
+        g_Renderer,
+        nullptr,
+        this->shape_vertices.data(),
+        static_cast<int>(this->shape_vertices.size()),
+        this->shape_indices.data(),
+        static_cast<int>(this->shape_indices.size())
+    );
+    this->CountDrawCalls(1);
+    this->shape_vertices.clear();
+    this->shape_indices.clear();
+#endif
+}
+
+void Renderer::SetShapeBatching(const bool shape_batching) {
+    this->FlushShapes();
+    this->shape_batching = shape_batching;
+}
+
+bool Renderer::BeginLayer(sdl2::Texture target, const i32 x, const i32 y) {
+    this->FlushShapes();
+    const auto prev_target = SDL_GetRenderTarget(g_Renderer);
+    if (SDL_SetRenderTarget(g_Renderer, target) != 0) {
+        return false;
+    }
+
+    this->layer_stack.push_back({prev_target, this->base_x, this->base_y, this->base_a});
+    this->base_x = -x;
+    this->base_y = -y;
+    this->base_a = TextureRenderOptions::NoAlpha;
+
+    SDL_SetRenderDrawColor(g_Renderer, 0, 0, 0, 0);
+    SDL_RenderClear(g_Renderer);
+    return true;
+}
+
+void Renderer::EndLayer() {
+    if (this->layer_stack.empty()) {
+        return;
+    }
+    this->FlushShapes();
+
+    const auto state = this->layer_stack.back();
+    this->layer_stack.pop_back();
+    SDL_SetRenderTarget(g_Renderer, state.prev_target);
+    this->base_x = state.base_x;
+    this->base_y = state.base_y;
+    this->base_a = state.base_a;
+}
+
+void Renderer::RenderLayer(sdl2::Texture layer, const i32 x, const i32 y) {
+    if (layer == nullptr) {
+        return;
+    }
+    this->FlushShapes();
+
+    static const auto premultiplied_blend = SDL_ComposeCustomBlendMode(
+        SDL_BLENDFACTOR_ONE,
+        SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        SDL_BLENDOPERATION_ADD,
+        SDL_BLENDFACTOR_ONE,
+        SDL_BLENDFACTOR_ONE_MINUS_SRC_ALPHA,
+        SDL_BLENDOPERATION_ADD
+    );
+    SDL_SetTextureBlendMode(layer, premultiplied_blend);
+
+    // Premultiplied colours have to fade along with the alpha
+    const u8 alpha = (this->base_a >= 0) ? static_cast<u8>(this->base_a) : 0xFF;
+    SDL_SetTextureColorMod(layer, alpha, alpha, alpha);
+    SDL_SetTextureAlphaMod(layer, alpha);
+
+    SDL_Rect pos = {.x = x + this->base_x, .y = y + this->base_y};
+    SDL_QueryTexture(layer, nullptr, nullptr, &pos.w, &pos.h);
+    SDL_RenderCopy(g_Renderer, layer, nullptr, &pos);
+    this->CountDrawCalls(1);
+}
+
 sdl2::Renderer GetMainRenderer() {
+    // Whatever the caller draws has to land on top of the shapes drawn before it
+    if ((g_BatchingRenderer != nullptr) && (std::this_thread::get_id() == g_RenderThreadId)) {
+        g_BatchingRenderer->FlushShapes();
+    }
     return g_Renderer;
 }
 
@@ -388,6 +846,16 @@ bool AddFont(const std::string& font_name, std::shared_ptr<ttf::Font>& font) {
     return true;
 }
 
+std::shared_ptr<ttf::Font> GetFont(const std::string& font_name) {
+    for (const auto& [name, font] : g_FontTable) {
+        if (name == font_name) {
+            return font;
+        }
+    }
+
+    return nullptr;
+}
+
 bool LoadSingleSharedFontInFont(std::shared_ptr<ttf::Font>& font, const PlSharedFontType type) {
     // Assume pl services are initialized, and return if anything unexpected happens
     PlFontData data = {};
@@ -447,32 +915,39 @@ sdl2::Texture RenderText(
 ) {
     for (auto& [name, font] : g_FontTable) {
         if (name == font_name) {
-            auto text_tex = font->RenderText(text, clr);
-
-            if ((max_width > 0) || (max_height > 0)) {
-                auto cur_text = text;
-                auto cur_width = GetTextureWidth(text_tex);
-                auto cur_height = GetTextureHeight(text_tex);
-                while (true) {
-                    if (cur_text.empty()) {
-                        break;
+            if (((max_width > 0) || (max_height > 0)) && !text.empty()) {
+                const auto fits = [&](const std::string& str) {
+                    const auto [cur_width, cur_height] = MeasureRenderedText(*font, str);
+                    return ((max_width > 0) && (cur_width <= (i32)max_width)) ||
+                        ((max_height > 0) && (cur_height <= (i32)max_height));
+                };
+
+                if (!fits(text)) {
+                    // Binary search the longest prefix, cut on a UTF-8 boundary, that fits with the ellipsis.
+                    // If nothing fits the empty prefix is used, leaving just the ellipsis.
+                    std::vector<size_t> cuts = {0};
+                    for (size_t i = 1; i < text.length(); i++) {
+                        if (!IsUtf8Continuation(text[i])) {
+                            cuts.push_back(i);
+                        }
                     }
-                    if ((max_width > 0) && (cur_width <= (i32)max_width)) {
-                        break;
-                    }
-                    if ((max_height > 0) && (cur_height <= (i32)max_height)) {
-                        break;
+
+                    size_t low = 0;
+                    size_t high = cuts.size() - 1;
+                    while (low < high) {
+                        const auto mid = (low + high + 1) / 2;
+                        if (fits(text.substr(0, cuts[mid]) + "...")) {
+                            low = mid;
+                        } else {
+                            high = mid - 1;
+                        }
                     }
 
-                    cur_text.pop_back();
-                    DeleteTexture(text_tex);
-                    text_tex = font->RenderText(cur_text + "...", clr);
-                    cur_width = GetTextureWidth(text_tex);
-                    cur_height = GetTextureHeight(text_tex);
+                    return font->RenderText(text.substr(0, cuts[low]) + "...", clr);
                 }
             }
 
-            return text_tex;
+            return font->RenderText(text, clr);
         }
     }
 
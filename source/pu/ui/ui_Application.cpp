@@ -21,6 +21,10 @@ namespace pu::ui {
         this->fade_alpha_incr = {};
         this->fade_bg_tex = {};
         this->fade_bg_clr = { 0, 0, 0, 0xFF };
+        this->skip_idle_frames = true;
+        this->last_input_time = std::chrono::steady_clock::now();
+        this->rendered_frame_count = 0;
+        this->skipped_frame_count = 0;
         rmutexInit(&this->render_lock);
     }
 
@@ -106,6 +110,20 @@ namespace pu::ui {
             return false;
         }
 
+        const auto frame_start = std::chrono::steady_clock::now();
+        this->renderer->UpdateInput();
+        if(!this->NeedsRender()) {
+            // Nothing changed, keep callbacks and input handlers running but leave the last frame on screen
+            this->OnIdle();
+            this->skipped_frame_count++;
+
+            const u64 elapsed_ns = std::chrono::duration_cast<std::chrono::nanoseconds>(std::chrono::steady_clock::now() - frame_start).count();
+            if(elapsed_ns < IdleFrameTimeNs) {
+                svcSleepThread(IdleFrameTimeNs - elapsed_ns);
+            }
+            return true;
+        }
+
         auto continue_render = true;
         this->renderer->InitializeRender(this->lyt->GetBackgroundColor());
         this->OnRender();
@@ -115,9 +133,32 @@ namespace pu::ui {
             this->render_over_fn = {};
         }
         this->renderer->FinalizeRender();
+        this->rendered_frame_count++;
         return continue_render;
     }
 
+    bool Application::NeedsRender() {
+        // Always consumed, so a request made while drawing this frame only causes one more frame
+        const auto redraw_requested = ConsumeRedrawRequest();
+
+        const auto time_now = std::chrono::steady_clock::now();
+        const auto has_input = (this->GetButtonsDown() | this->GetButtonsUp() | this->GetButtonsHeld()) != 0;
+        if(has_input || (this->GetTouchState().count > 0) || this->lyt->HasSimulatedTouchPosition()) {
+            this->last_input_time = time_now;
+        }
+
+        if(!this->skip_idle_frames || redraw_requested) {
+            return true;
+        }
+        // Dialogs, overlays and fades animate on their own
+        if(this->in_render_over || (this->ovl != nullptr) || (this->fade_alpha != 0xFF)) {
+            return true;
+        }
+
+        const u64 since_input_ms = std::chrono::duration_cast<std::chrono::milliseconds>(time_now - this->last_input_time).count();
+        return since_input_ms < InputRedrawDurationMs;
+    }
+
     bool Application::CallForRenderWithRenderOver(RenderOverFunction render_over_fn) {
         this->in_render_over = true;
         this->render_over_fn = render_over_fn;
@@ -130,6 +171,8 @@ namespace pu::ui {
         while(true) {
             this->CallForRender();
             if(this->fade_alpha_incr.Increment(this->fade_alpha)) {
+                // fade_alpha is back at 0xFF, which NeedsRender treats as idle, so the last frame is asked for
+                RequestRedraw();
                 break;
             }
         }
@@ -142,6 +185,8 @@ namespace pu::ui {
         while(true) {
             this->CallForRender();
             if(this->fade_alpha_incr.Increment(this->fade_alpha)) {
+                // Ask for the last frame explicitly rather than relying on fade_alpha to keep frames drawing
+                RequestRedraw();
                 break;
             }
         }
@@ -164,7 +209,6 @@ namespace pu::ui {
 
     void Application::OnRender() {
         this->LockRender();
-        this->renderer->UpdateInput();
         const auto keys_down = this->GetButtonsDown();
         const auto keys_up = this->GetButtonsUp();
         const auto keys_held = this->GetButtonsHeld();
@@ -277,6 +321,54 @@ namespace pu::ui {
         this->UnlockRender();
     }
 
+    void Application::OnIdle() {
+        // Same callbacks and input handlers as OnRender, without drawing. There is no input on idle frames.
+        this->LockRender();
+        auto start_lyt = this->lyt;
+        auto lyt_changed = false;
+        const TouchPoint tch_pos = {};
+
+        for(auto &render_cb: this->render_cbs) {
+            if(render_cb) {
+                _ONLY_DO_UNCHANGED(
+                    render_cb();
+                );
+            }
+        }
+
+        for(auto &lyt_render_cb: this->lyt->GetRenderCallbacks()) {
+            if(lyt_render_cb) {
+                _ONLY_DO_UNCHANGED(
+                    lyt_render_cb();
+                );
+            }
+        }
+
+        if(this->on_ipt_cb) {
+            _ONLY_DO_UNCHANGED(
+                (this->on_ipt_cb)(0, 0, 0, tch_pos);
+            );
+        }
+
+        auto lyt_on_ipt_cb = this->lyt->GetOnInput();
+        if(lyt_on_ipt_cb) {
+            _ONLY_DO_UNCHANGED(
+                lyt_on_ipt_cb(0, 0, 0, tch_pos);
+            );
+        }
+
+        auto lyt_elems = this->lyt->GetElements();
+        for(auto &elem: lyt_elems) {
+            _ONLY_DO_UNCHANGED(
+                if(elem->IsVisible()) {
+                    elem->OnInput(0, 0, 0, tch_pos);
+                }
+            );
+        }
+
+        this->UnlockRender();
+    }
+
     void Application::Close(const bool do_exit) {
         this->is_shown = false;
     }
@@ -1,7 +1,23 @@
 #include <pu/ui/ui_Types.hpp>
+#include <atomic>
 
 namespace pu::ui {
 
+    namespace {
+
+        // The first frame always has to be drawn
+        std::atomic_bool g_RedrawRequested = true;
+
+    }
+
+    void RequestRedraw() {
+        g_RedrawRequested.store(true, std::memory_order_release);
+    }
+
+    bool ConsumeRedrawRequest() {
+        return g_RedrawRequested.exchange(false, std::memory_order_acq_rel);
+    }
+
     Color Color::FromHex(const std::string &str_clr) {
         std::string r = "00";
         std::string g = "00";
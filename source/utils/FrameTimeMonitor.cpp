@@ -0,0 +1,62 @@
+#include "utils/FrameTimeMonitor.hpp"
+
+#include <string>
+
+#include "utils/Logger.hpp"
+
+namespace pksm::utils {
+
+void FrameTimeMonitor::Tick(u64 renderedFrameCount, u64 skippedFrameCount, u64 drawCallCount) {
+    const auto now = std::chrono::steady_clock::now();
+    if (!hasLastFrame) {
+        lastFrame = now;
+        hasLastFrame = true;
+        renderedFramesStart = now;
+        renderedFramesAtStart = renderedFrameCount;
+        skippedFramesAtStart = skippedFrameCount;
+        drawCallsAtStart = drawCallCount;
+        return;
+    }
+
+    if (now - renderedFramesStart >= RENDERED_FRAMES_INTERVAL) {
+        const u64 renderedFrames = renderedFrameCount - renderedFramesAtStart;
+        const u64 skippedFrames = skippedFrameCount - skippedFramesAtStart;
+        const u64 drawCalls = drawCallCount - drawCallsAtStart;
+        LOG_DEBUG(
+            "Rendered " + std::to_string(renderedFrames) + " frames and skipped " + std::to_string(skippedFrames) +
+            " idle frames in the last " + std::to_string(RENDERED_FRAMES_INTERVAL.count()) + "s, " +
+            std::to_string(renderedFrames > 0 ? drawCalls / renderedFrames : 0) + " draw calls per frame"
+        );
+        renderedFramesStart = now;
+        renderedFramesAtStart = renderedFrameCount;
+        skippedFramesAtStart = skippedFrameCount;
+        drawCallsAtStart = drawCallCount;
+    }
+
+    const auto frameTime = std::chrono::duration_cast<std::chrono::microseconds>(now - lastFrame);
+    lastFrame = now;
+
+    frameCount++;
+    totalTime += frameTime;
+    if (frameTime > worstTime) {
+        worstTime = frameTime;
+    }
+    if (frameTime > SLOW_FRAME_THRESHOLD) {
+        slowFrameCount++;
+        LOG_WARNING("Slow frame: " + std::to_string(frameTime.count()) + "us");
+    }
+
+    if (frameCount >= SUMMARY_INTERVAL) {
+        LOG_DEBUG(
+            "Frame times over " + std::to_string(frameCount) +
+            " frames: avg=" + std::to_string(totalTime.count() / static_cast<long long>(frameCount)) +
+            "us worst=" + std::to_string(worstTime.count()) + "us slow=" + std::to_string(slowFrameCount)
+        );
+        frameCount = 0;
+        slowFrameCount = 0;
+        totalTime = std::chrono::microseconds{0};
+        worstTime = std::chrono::microseconds{0};
+    }
+}
+
+}  // namespace pksm::utils
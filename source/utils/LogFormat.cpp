@@ -0,0 +1,153 @@
+#include "utils/LogFormat.hpp"
+
+#include <algorithm>
+#include <charconv>
+#include <cstdint>
+#include <cstring>
+
+namespace pksm::utils {
+
+namespace {
+
+// Appends to a fixed buffer, counting what doesn't fit so the full length is known
+class MessageWriter {
+public:
+    MessageWriter(char* out, size_t capacity) : out(out), capacity(capacity) {}
+
+    void Append(std::string_view text) {
+        if (length < capacity) {
+            std::memcpy(out + length, text.data(), std::min(text.size(), capacity - length));
+        }
+        length += text.size();
+    }
+
+    void Append(char c, size_t count = 1) {
+        for (size_t i = 0; i < count; i++) {
+            if (length < capacity) {
+                out[length] = c;
+            }
+            length++;
+        }
+    }
+
+    size_t GetLength() const { return length; }
+
+private:
+    char* out;
+    size_t capacity;
+    size_t length = 0;
+};
+
+struct FormatSpec {
+    char fill = ' ';
+    size_t width = 0;
+    bool hex = false;
+};
+
+// Parse the part of a replacement field between ':' and '}'
+FormatSpec ParseSpec(std::string_view spec) {
+    FormatSpec result;
+    if (!spec.empty() && spec.front() == '0') {
+        result.fill = '0';
+        spec.remove_prefix(1);
+    }
+    while (!spec.empty() && spec.front() >= '0' && spec.front() <= '9') {
+        result.width = result.width * 10 + static_cast<size_t>(spec.front() - '0');
+        spec.remove_prefix(1);
+    }
+    result.hex = !spec.empty() && spec.front() == 'x';
+    return result;
+}
+
+void AppendArg(MessageWriter& writer, const LogArg& arg, const FormatSpec& spec) {
+    char digits[64];
+    std::to_chars_result result{digits, std::errc()};
+    std::string_view text;
+
+    switch (arg.kind) {
+        case LogArg::Kind::Signed:
+            result = std::to_chars(digits, digits + sizeof(digits), arg.signedValue, spec.hex ? 16 : 10);
+            break;
+        case LogArg::Kind::Unsigned:
+            result = std::to_chars(digits, digits + sizeof(digits), arg.unsignedValue, spec.hex ? 16 : 10);
+            break;
+        case LogArg::Kind::Float:
+            result = std::to_chars(digits, digits + sizeof(digits), arg.floatValue);
+            break;
+        case LogArg::Kind::Bool:
+            text = arg.boolValue ? "true" : "false";
+            break;
+        case LogArg::Kind::String:
+            text = arg.stringValue;
+            break;
+        case LogArg::Kind::Pointer: {
+            const auto address = reinterpret_cast<uintptr_t>(arg.pointerValue);
+            digits[0] = '0';
+            digits[1] = 'x';
+            result = std::to_chars(digits + 2, digits + sizeof(digits), address, 16);
+            break;
+        }
+    }
+    if (text.empty() && result.ptr != digits) {
+        text = std::string_view(digits, static_cast<size_t>(result.ptr - digits));
+    }
+
+    if (text.size() < spec.width) {
+        // Zero padding goes after a minus sign
+        if (spec.fill == '0' && !text.empty() && text.front() == '-') {
+            writer.Append('-');
+            text.remove_prefix(1);
+            writer.Append('0', spec.width - text.size() - 1);
+        } else {
+            writer.Append(spec.fill, spec.width - text.size());
+        }
+    }
+    writer.Append(text);
+}
+
+}  // namespace
+
+size_t FormatLogMessage(char* out, size_t capacity, std::string_view format, std::initializer_list<LogArg> args) {
+    MessageWriter writer(out, capacity);
+    auto nextArg = args.begin();
+
+    size_t pos = 0;
+    while (pos < format.size()) {
+        const size_t brace = format.find_first_of("{}", pos);
+        if (brace == std::string_view::npos) {
+            writer.Append(format.substr(pos));
+            break;
+        }
+        writer.Append(format.substr(pos, brace - pos));
+
+        // Doubled braces are literal
+        if (brace + 1 < format.size() && format[brace + 1] == format[brace]) {
+            writer.Append(format[brace]);
+            pos = brace + 2;
+            continue;
+        }
+
+        const size_t close = (format[brace] == '{') ? format.find('}', brace) : std::string_view::npos;
+        if (close == std::string_view::npos) {
+            // A stray brace is written as is
+            writer.Append(format[brace]);
+            pos = brace + 1;
+            continue;
+        }
+
+        std::string_view spec = format.substr(brace + 1, close - brace - 1);
+        if (!spec.empty() && spec.front() == ':') {
+            spec.remove_prefix(1);
+        }
+        if (nextArg != args.end()) {
+            AppendArg(writer, *nextArg++, ParseSpec(spec));
+        } else {
+            writer.Append("{?}");
+        }
+        pos = close + 1;
+    }
+
+    return writer.GetLength();
+}
+
+}  // namespace pksm::utils
@@ -0,0 +1,51 @@
+#include "utils/LogRing.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+namespace pksm::utils {
+
+LogRing::LogRing(size_t capacity) {
+    size_t size = 2;
+    while (size < capacity) {
+        size *= 2;
+    }
+
+    slots = std::make_unique<Slot[]>(size);
+    mask = size - 1;
+    for (size_t i = 0; i < size; i++) {
+        slots[i].sequence.store(i, std::memory_order_relaxed);
+    }
+}
+
+bool LogRing::TryPush(u64 tick, u8 level, const char* text, size_t length) {
+    size_t pos = enqueuePos.load(std::memory_order_relaxed);
+    Slot* slot;
+    while (true) {
+        slot = &slots[pos & mask];
+        const size_t sequence = slot->sequence.load(std::memory_order_acquire);
+        const auto difference = static_cast<std::ptrdiff_t>(sequence) - static_cast<std::ptrdiff_t>(pos);
+        if (difference == 0) {
+            // The slot is free; claim it unless another thread got there first
+            if (enqueuePos.compare_exchange_weak(pos, pos + 1, std::memory_order_relaxed)) {
+                break;
+            }
+        } else if (difference < 0) {
+            // The consumer hasn't freed this slot since the last lap, so the queue is full
+            dropped.fetch_add(1, std::memory_order_relaxed);
+            return false;
+        } else {
+            pos = enqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+
+    slot->record.tick = tick;
+    slot->record.level = level;
+    slot->record.truncated = length > TEXT_SIZE;
+    slot->record.length = static_cast<u16>(std::min(length, TEXT_SIZE));
+    std::memcpy(slot->record.text, text, slot->record.length);
+    slot->sequence.store(pos + 1, std::memory_order_release);
+    return true;
+}
+
+}  // namespace pksm::utils
@@ -1,15 +1,92 @@
 #include "utils/Logger.hpp"
 
+#include <chrono>
 #include <cstdio>
 #include <ctime>
-#include <iomanip>
+#include <memory>
 #include <sstream>
+#include <thread>
+#include <vector>
+
+#include "utils/LogRing.hpp"
 
 #ifndef NDEBUG
 
 namespace pksm::utils {
 
-bool Logger::initialized = false;
+namespace {
+
+// 256KB of messages; bursts bigger than this before the writer catches up are dropped
+constexpr size_t RING_CAPACITY = 512;
+
+// The writer takes at most this many messages per write to the sink
+constexpr size_t BATCH_RECORDS = 64;
+
+// How long the writer sleeps when there is nothing to write
+constexpr std::chrono::milliseconds IDLE_SLEEP{2};
+
+std::unique_ptr<LogRing> ring;
+std::thread writer;
+std::atomic<bool> stopping{false};
+
+// Wall clock time matching a monotonic tick, so records only need the cheap monotonic clock
+std::chrono::system_clock::time_point startWallTime;
+u64 startTick = 0;
+
+u64 MonotonicTick() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+const char* LevelPrefix(u8 level) {
+    switch (static_cast<Logger::Level>(level)) {
+        case Logger::Level::Debug:
+            return "[DEBUG] ";
+        case Logger::Level::Info:
+            return "[INFO] ";
+        case Logger::Level::Warning:
+            return "[WARNING] ";
+        case Logger::Level::Error:
+            return "[ERROR] ";
+    }
+    return "";
+}
+
+void AppendLine(std::vector<char>& batch, u64 tick, u8 level, const char* text, size_t length, bool truncated) {
+    const auto sinceStart = std::chrono::nanoseconds(tick - startTick);
+    const auto wallTime = startWallTime + std::chrono::duration_cast<std::chrono::system_clock::duration>(sinceStart);
+    const std::time_t seconds = std::chrono::system_clock::to_time_t(wallTime);
+    const auto millis =
+        std::chrono::duration_cast<std::chrono::milliseconds>(wallTime.time_since_epoch()).count() % 1000;
+
+    std::tm localTime;
+    localtime_r(&seconds, &localTime);
+    char prefix[64];
+    const size_t timeLength = std::strftime(prefix, sizeof(prefix), "[%H:%M:%S", &localTime);
+    const int levelLength = std::snprintf(
+        prefix + timeLength,
+        sizeof(prefix) - timeLength,
+        ".%03d] %s",
+        static_cast<int>(millis),
+        LevelPrefix(level)
+    );
+
+    batch.insert(batch.end(), prefix, prefix + timeLength + levelLength);
+    batch.insert(batch.end(), text, text + length);
+    if (truncated) {
+        static constexpr char ellipsis[] = "...";
+        batch.insert(batch.end(), ellipsis, ellipsis + sizeof(ellipsis) - 1);
+    }
+    batch.push_back('\n');
+}
+
+static_assert(Logger::MAX_MESSAGE_SIZE == LogRing::TEXT_SIZE, "Formatted messages should fill a ring record");
+
+}  // namespace
+
+std::atomic<int> Logger::threshold{Logger::DISABLED};
+Logger::Level Logger::minimumLevel = Logger::Level::Debug;
+std::atomic<bool> Logger::initialized{false};
 bool Logger::socket_initialized = false;
 bool Logger::console_initialized = false;
 
@@ -31,16 +108,99 @@ void Logger::Initialize() {
             }
         }
 
-        initialized = socket_initialized && console_initialized;
-
-        if (initialized) {
+        if (socket_initialized && console_initialized) {
+            // The writer sends each batch with one write, so stdout's buffer would only add a copy
             setvbuf(stdout, NULL, _IONBF, 0);
+            StartWriter(stdout);
+        }
+    }
+}
+
+void Logger::Initialize(std::FILE* sink) {
+    if (!initialized && sink) {
+        StartWriter(sink);
+    }
+}
+
+void Logger::StartWriter(std::FILE* sink) {
+    if (!ring) {
+        ring = std::make_unique<LogRing>(RING_CAPACITY);
+    }
+    startWallTime = std::chrono::system_clock::now();
+    startTick = MonotonicTick();
+
+    stopping = false;
+    writer = std::thread(&Logger::WriterLoop, sink);
+    initialized = true;
+    // Enabling logging last publishes the queue to threads that check IsEnabled
+    threshold.store(static_cast<int>(minimumLevel), std::memory_order_release);
+}
+
+void Logger::SetLevel(Level level) {
+    minimumLevel = level;
+    if (initialized) {
+        threshold.store(static_cast<int>(level), std::memory_order_release);
+    }
+}
+
+void Logger::WriterLoop(std::FILE* sink) {
+    std::vector<char> batch;
+    batch.reserve(BATCH_RECORDS * (LogRing::TEXT_SIZE + 32));
+
+    while (true) {
+        // Read the flag first, so everything logged before Finalize is written before stopping
+        const bool stop = stopping.load(std::memory_order_acquire);
+
+        batch.clear();
+        const size_t count = ring->Drain(
+            [&batch](const LogRing::Record& record) {
+                AppendLine(batch, record.tick, record.level, record.text, record.length, record.truncated);
+            },
+            BATCH_RECORDS
+        );
+
+        if (const u64 dropped = ring->TakeDropped()) {
+            const std::string message = std::to_string(dropped) + " log messages dropped, the log queue was full";
+            AppendLine(
+                batch,
+                MonotonicTick(),
+                static_cast<u8>(Level::Warning),
+                message.data(),
+                message.size(),
+                false
+            );
+        }
+
+        if (!batch.empty()) {
+            std::fwrite(batch.data(), 1, batch.size(), sink);
+            std::fflush(sink);
+
+            // Give nxlink a moment to send before the next batch
+            if (socket_initialized) {
+                svcSleepThread(1'000'000);  // 1ms delay
+            }
+        }
+
+        if (count == 0) {
+            if (stop) {
+                return;
+            }
+            std::this_thread::sleep_for(IDLE_SLEEP);
         }
     }
 }
 
 void Logger::Finalize() {
     if (initialized) {
+        // Logging stops here; the writer drains what was queued before it exits. The queue itself
+        // is kept, since another thread may be pushing to it right now.
+        threshold.store(DISABLED, std::memory_order_release);
+        initialized = false;
+        stopping = true;
+        if (writer.joinable()) {
+            writer.join();
+        }
+
         if (socket_initialized) {
             socketExit();
             socket_initialized = false;
@@ -51,57 +211,28 @@ void Logger::Finalize() {
 }
 
 void Logger::Debug(const std::string& message) {
-    Log(Level::Debug, message);
+    Log(Level::Debug, message.data(), message.size());
 }
 
 void Logger::Info(const std::string& message) {
-    Log(Level::Info, message);
+    Log(Level::Info, message.data(), message.size());
 }
 
 void Logger::Warning(const std::string& message) {
-    Log(Level::Warning, message);
+    Log(Level::Warning, message.data(), message.size());
 }
 
 void Logger::Error(const std::string& message) {
-    Log(Level::Error, message);
+    Log(Level::Error, message.data(), message.size());
 }
 
-void Logger::Log(Level level, const std::string& message) {
-    if (!initialized || (!socket_initialized && !console_initialized)) {
+void Logger::Log(Level level, const char* text, size_t length) {
+    if (!IsEnabled(level)) {
         return;
     }
 
-    // Get current time
-    auto now = std::time(nullptr);
-    auto tm = std::localtime(&now);
-
-    std::stringstream ss;
-    ss << "[" << std::put_time(tm, "%H:%M:%S") << "] ";
-
-    // Add log level
-    switch (level) {
-        case Level::Debug:
-            ss << "[DEBUG] ";
-            break;
-        case Level::Info:
-            ss << "[INFO] ";
-            break;
-        case Level::Warning:
-            ss << "[WARNING] ";
-            break;
-        case Level::Error:
-            ss << "[ERROR] ";
-            break;
-    }
-
-    ss << message << std::endl;
-    printf("%s", ss.str().c_str());
-    fflush(stdout);
-
-    // Give a small delay after each log to ensure it's flushed
-    if (socket_initialized) {
-        svcSleepThread(1'000'000);  // 1ms delay
-    }
+    // Timestamps and level names are formatted on the writer thread
+    ring->TryPush(MonotonicTick(), static_cast<u8>(level), text, length);
 }
 
 void Logger::LogMemoryInfo() {
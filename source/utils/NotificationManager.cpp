@@ -1,5 +1,7 @@
 #include "utils/NotificationManager.hpp"
 
+#include <pu/Plutonium>
+
 namespace pksm::utils {
 
 std::mutex NotificationManager::mutex;
@@ -8,11 +10,13 @@ std::vector<NotificationManager::Notification> NotificationManager::pending;
 void NotificationManager::Push(const std::string& text) {
     std::scoped_lock lock(mutex);
     pending.push_back(Notification{text, ""});
+    pu::ui::RequestRedraw();
 }
 
 void NotificationManager::Push(const std::string& title, const std::string& body) {
     std::scoped_lock lock(mutex);
     pending.push_back(Notification{title, body});
+    pu::ui::RequestRedraw();
 }
 
 std::vector<NotificationManager::Notification> NotificationManager::ConsumeAll() {
@@ -1,24 +1,45 @@
 #include "utils/PokemonSpriteManager.hpp"
 
+#include <algorithm>
 #include <fstream>
+#include <iterator>
 #include <nlohmann/json.hpp>
-#include <sstream>
 
+#include "pksmcore/utils/endian.hpp"
 #include "utils/Logger.hpp"
+#include "utils/Trace.hpp"
 
 namespace pksm::utils {
 
 // Initialize static members
 bool PokemonSpriteManager::initialized = false;
-std::map<std::string, pu::sdl2::TextureHandle::Ref> PokemonSpriteManager::spriteCache;
-std::map<std::string, std::string> PokemonSpriteManager::spritePaths;
+SpriteCache PokemonSpriteManager::spriteCache(PokemonSpriteManager::DEFAULT_CACHE_BUDGET);
+std::unordered_map<u32, std::string> PokemonSpriteManager::spritePaths;
+std::vector<PokemonSpriteManager::AtlasEntry> PokemonSpriteManager::atlasEntries;
+std::vector<pu::sdl2::TextureHandle::Ref> PokemonSpriteManager::atlasPages;
+std::string PokemonSpriteManager::atlasPageBasePath;
+SpriteDecoder PokemonSpriteManager::decoder;
+std::unordered_set<u32> PokemonSpriteManager::failedDecodes;
+
+bool PokemonSpriteManager::Initialize(const std::string& jsonPath, const std::string& atlasIndexPath) {
+    TRACE_SCOPE("PokemonSpriteManager::Initialize");
 
-bool PokemonSpriteManager::Initialize(const std::string& jsonPath) {
     // Don't initialize twice
     if (initialized) {
         return true;
     }
 
+    // Prefer the packed atlas, which needs one image load per page instead of one per sprite
+    if (!atlasIndexPath.empty() && ParseAtlasIndex(atlasIndexPath)) {
+        decoder.Start();
+        initialized = true;
+        LOG_DEBUG(
+            "Pokemon sprite manager initialized successfully with " + std::to_string(atlasEntries.size()) +
+            " atlas sprites on " + std::to_string(atlasPages.size()) + " pages"
+        );
+        return true;
+    }
+
     LOG_DEBUG("Initializing Pokemon sprite manager from " + jsonPath);
 
     // Parse JSON metadata
@@ -27,116 +48,206 @@ bool PokemonSpriteManager::Initialize(const std::string& jsonPath) {
         return false;
     }
 
+    decoder.Start();
     initialized = true;
     LOG_DEBUG("Pokemon sprite manager initialized successfully with " + std::to_string(spritePaths.size()) + " sprites");
     return true;
 }
 
-pu::sdl2::TextureHandle::Ref PokemonSpriteManager::GetPokemonSprite(u16 species, u8 form, bool shiny) {
-    // If this is an empty slot, return nullptr
+PokemonSprite PokemonSpriteManager::GetPokemonSprite(u16 species, u8 form, bool shiny) {
+    // If this is an empty slot, return an empty sprite
     if (species == 0) {
-        return nullptr;
+        return PokemonSprite();
     }
 
-    // Generate the key for this Pokemon
-    std::string key = GenerateKey(species, form, shiny);
+    std::optional<u32> key = ResolveKey(species, form, shiny);
+    if (!key) {
+        // Sprite not found
+        LOG_ERROR(
+            "Failed to find sprite for species " + std::to_string(species) + ", form " + std::to_string(form) +
+            ", shiny " + std::to_string(shiny)
+        );
+        return PokemonSprite();
+    }
 
-    // First check if we've already loaded this sprite
-    auto it = spriteCache.find(key);
-    if (it != spriteCache.end()) {
-        return it->second;
+    return LoadSprite(*key);
+}
+
+std::optional<PokemonSprite> PokemonSpriteManager::TryGetPokemonSprite(u16 species, u8 form, bool shiny) {
+    if (species == 0) {
+        return PokemonSprite();
     }
 
-    // If not in cache, look for the file path
-    auto pathIt = spritePaths.find(key);
-    if (pathIt != spritePaths.end()) {
-        pu::sdl2::TextureHandle::Ref texture = LoadSpriteFromFile(pathIt->second);
-        // Cache the texture for future use
-        if (texture) {
-            spriteCache[key] = texture;
-        }
-        return texture;
+    // With no sprite to fall back to there is nothing to wait for
+    std::optional<u32> key = ResolveKey(species, form, shiny);
+    if (!key) {
+        return PokemonSprite();
     }
 
-    // Try fallback to normal form if form > 0
-    if (form > 0) {
-        key = GenerateKey(species, 0, shiny);
-        pathIt = spritePaths.find(key);
-        if (pathIt != spritePaths.end()) {
-            pu::sdl2::TextureHandle::Ref texture = LoadSpriteFromFile(pathIt->second);
-            if (texture) {
-                spriteCache[key] = texture;
+    return GetLoadedSprite(*key, true);
+}
+
+void PokemonSpriteManager::PrefetchPokemonSprite(u16 species, u8 form, bool shiny) {
+    if (species == 0) {
+        return;
+    }
+
+    std::optional<u32> key = ResolveKey(species, form, shiny);
+    if (key) {
+        GetLoadedSprite(*key, false);
+    }
+}
+
+void PokemonSpriteManager::ProcessDecodedSprites(std::chrono::microseconds budget) {
+    const auto start = std::chrono::steady_clock::now();
+
+    SpriteDecoder::DecodedImage image;
+    while (decoder.TakeDecoded(image)) {
+        // ConvertToTexture takes ownership of the surface
+        SDL_Texture* texture = pu::ui::render::ConvertToTexture(image.surface);
+        if (!texture) {
+            LOG_ERROR("Failed to load sprite texture: " + image.path);
+            failedDecodes.insert(image.id);
+        } else {
+            SDL_SetTextureBlendMode(texture, sdl::BlendModeBlend());
+            pu::sdl2::TextureHandle::Ref handle = pu::sdl2::TextureHandle::New(texture);
+            if (image.id & ATLAS_PAGE_ID) {
+                const u32 page = image.id & ~ATLAS_PAGE_ID;
+                if (page < atlasPages.size()) {
+                    atlasPages[page] = handle;
+                }
+            } else {
+                spriteCache.Put(image.id, handle);
             }
-            return texture;
+        }
+
+        // Always upload at least one image so progress is made even on slow frames
+        if (std::chrono::steady_clock::now() - start >= budget) {
+            break;
         }
     }
+}
 
-    // Try fallback to non-shiny if shiny
-    if (shiny) {
-        key = GenerateKey(species, form, false);
-        pathIt = spritePaths.find(key);
-        if (pathIt != spritePaths.end()) {
-            pu::sdl2::TextureHandle::Ref texture = LoadSpriteFromFile(pathIt->second);
-            if (texture) {
-                spriteCache[key] = texture;
-            }
-            return texture;
+std::optional<u32> PokemonSpriteManager::ResolveKey(u16 species, u8 form, bool shiny) {
+    const u32 candidates[] = {
+        GenerateKey(species, form, shiny),
+        // Fallback to normal form
+        GenerateKey(species, 0, shiny),
+        // Fallback to non-shiny
+        GenerateKey(species, form, false),
+        // Fallback to non-shiny, form 0
+        GenerateKey(species, 0, false),
+    };
+
+    for (u32 key : candidates) {
+        if (atlasEntries.empty() ? spritePaths.contains(key) : FindAtlasEntry(key) != nullptr) {
+            return key;
         }
     }
+    return std::nullopt;
+}
 
-    // Try fallback to non-shiny, form 0
-    if (shiny && form > 0) {
-        key = GenerateKey(species, 0, false);
-        pathIt = spritePaths.find(key);
-        if (pathIt != spritePaths.end()) {
-            pu::sdl2::TextureHandle::Ref texture = LoadSpriteFromFile(pathIt->second);
-            if (texture) {
-                spriteCache[key] = texture;
-            }
-            return texture;
+const PokemonSpriteManager::AtlasEntry* PokemonSpriteManager::FindAtlasEntry(u32 key) {
+    auto entryIt = std::lower_bound(
+        atlasEntries.begin(),
+        atlasEntries.end(),
+        key,
+        [](const AtlasEntry& entry, u32 target) { return entry.key < target; }
+    );
+    return entryIt != atlasEntries.end() && entryIt->key == key ? &*entryIt : nullptr;
+}
+
+PokemonSprite PokemonSpriteManager::LoadSprite(u32 key) {
+    if (const AtlasEntry* entry = FindAtlasEntry(key)) {
+        pu::sdl2::TextureHandle::Ref page = GetAtlasPage(entry->page);
+        return page ? PokemonSprite(page, entry->rect) : PokemonSprite();
+    }
+
+    // First check if we've already loaded this sprite
+    pu::sdl2::TextureHandle::Ref texture = spriteCache.Get(key);
+    if (!texture) {
+        // If not in cache, look for the file path
+        auto pathIt = spritePaths.find(key);
+        if (pathIt == spritePaths.end()) {
+            return PokemonSprite();
         }
+
+        texture = LoadSpriteFromFile(pathIt->second);
+        if (!texture) {
+            return PokemonSprite();
+        }
+
+        // Cache the texture for future use
+        spriteCache.Put(key, texture);
     }
 
-    // Sprite not found
-    LOG_ERROR(
-        "Failed to find sprite for species " + std::to_string(species) + ", form " + std::to_string(form) + ", shiny " +
-        std::to_string(shiny)
+    return WholeTextureSprite(texture);
+}
+
+std::optional<PokemonSprite> PokemonSpriteManager::GetLoadedSprite(u32 key, bool urgent) {
+    if (const AtlasEntry* entry = FindAtlasEntry(key)) {
+        if (atlasPages[entry->page]) {
+            return PokemonSprite(atlasPages[entry->page], entry->rect);
+        }
+
+        const u32 pageId = ATLAS_PAGE_ID | entry->page;
+        if (failedDecodes.contains(pageId)) {
+            return PokemonSprite();
+        }
+        decoder.Queue(pageId, AtlasPagePath(entry->page), urgent);
+        return std::nullopt;
+    }
+
+    if (pu::sdl2::TextureHandle::Ref texture = spriteCache.Get(key)) {
+        return WholeTextureSprite(texture);
+    }
+
+    auto pathIt = spritePaths.find(key);
+    if (pathIt == spritePaths.end() || failedDecodes.contains(key)) {
+        return PokemonSprite();
+    }
+    decoder.Queue(key, pathIt->second, urgent);
+    return std::nullopt;
+}
+
+PokemonSprite PokemonSpriteManager::WholeTextureSprite(pu::sdl2::TextureHandle::Ref texture) {
+    return PokemonSprite(
+        texture,
+        {0, 0, pu::ui::render::GetTextureWidth(texture->Get()), pu::ui::render::GetTextureHeight(texture->Get())}
     );
-    return nullptr;
 }
 
 void PokemonSpriteManager::Cleanup() {
+    // Stop decoding before releasing what it decodes into
+    decoder.Stop();
+    failedDecodes.clear();
+
     // Clear the cache to release texture memory
-    spriteCache.clear();
+    spriteCache.Clear();
     spritePaths.clear();
+    atlasEntries.clear();
+    atlasPages.clear();
+    atlasPageBasePath.clear();
     initialized = false;
 }
 
 void PokemonSpriteManager::ClearCache() {
     // Just clear the sprite cache, not the path mapping
-    LOG_DEBUG("Clearing sprite cache: " + std::to_string(spriteCache.size()) + " textures released");
-    spriteCache.clear();
-}
+    LOG_DEBUG("Clearing sprite cache: " + std::to_string(spriteCache.GetSize()) + " textures released");
+    spriteCache.Clear();
 
-void PokemonSpriteManager::ReleaseUnusedSprites(const std::set<std::string>& activeKeys) {
-    // Create a copy of the keys since we'll be modifying the map
-    std::vector<std::string> allKeys;
-    for (const auto& pair : spriteCache) {
-        allKeys.push_back(pair.first);
+    // Atlas pages reload on demand, so only the textures are dropped
+    for (auto& page : atlasPages) {
+        page = nullptr;
     }
+}
 
-    // Remove keys that aren't in the active list
-    for (const auto& key : allKeys) {
-        if (activeKeys.find(key) == activeKeys.end()) {
-            spriteCache.erase(key);
-        }
-    }
+void PokemonSpriteManager::SetCacheBudget(size_t budgetBytes) {
+    spriteCache.SetBudget(budgetBytes);
 }
 
-std::string PokemonSpriteManager::GenerateKey(u16 species, u8 form, bool shiny) {
-    std::stringstream ss;
-    ss << species << "-" << static_cast<int>(form) << "-" << (shiny ? "1" : "0");
-    return ss.str();
+u32 PokemonSpriteManager::GenerateKey(u16 species, u8 form, bool shiny) {
+    return (u32(species) << 9) | (u32(form) << 1) | (shiny ? 1 : 0);
 }
 
 bool PokemonSpriteManager::ParseJsonMetadata(const std::string& jsonPath) {
@@ -191,8 +302,7 @@ bool PokemonSpriteManager::ParseJsonMetadata(const std::string& jsonPath) {
             }
 
             // Generate key and store the sprite path
-            std::string key = GenerateKey(species, formId, isShiny);
-            spritePaths[key] = filePath;
+            spritePaths[GenerateKey(species, formId, isShiny)] = filePath;
         }
 
         LOG_DEBUG("Loaded " + std::to_string(spritePaths.size()) + " sprite paths from JSON");
@@ -203,6 +313,83 @@ bool PokemonSpriteManager::ParseJsonMetadata(const std::string& jsonPath) {
     }
 }
 
+bool PokemonSpriteManager::ParseAtlasIndex(const std::string& indexPath) {
+    // Index layout, little endian:
+    //   "PKSA" magic, u16 version, u16 page count, u32 entry count
+    //   per entry: u16 species, u8 form, u8 shiny, u16 page, u16 x, u16 y, u16 width, u16 height
+    static constexpr char MAGIC[4] = {'P', 'K', 'S', 'A'};
+    static constexpr u16 VERSION = 1;
+    static constexpr size_t HEADER_SIZE = 12;
+    static constexpr size_t ENTRY_SIZE = 14;
+
+    std::ifstream file(indexPath, std::ios::binary);
+    if (!file.is_open()) {
+        LOG_DEBUG("No sprite atlas index at " + indexPath);
+        return false;
+    }
+
+    LOG_DEBUG("Parsing sprite atlas index from " + indexPath);
+
+    std::vector<u8> data((std::istreambuf_iterator<char>(file)), std::istreambuf_iterator<char>());
+    file.close();
+
+    if (data.size() < HEADER_SIZE || !std::equal(std::begin(MAGIC), std::end(MAGIC), data.begin())) {
+        LOG_ERROR("Invalid sprite atlas index: " + indexPath);
+        return false;
+    }
+
+    const u16 version = LittleEndian::convertTo<u16>(data.data() + 4);
+    const u16 pageCount = LittleEndian::convertTo<u16>(data.data() + 6);
+    const u32 entryCount = LittleEndian::convertTo<u32>(data.data() + 8);
+    if (version != VERSION || data.size() != HEADER_SIZE + size_t(entryCount) * ENTRY_SIZE) {
+        LOG_ERROR("Unsupported or truncated sprite atlas index: " + indexPath);
+        return false;
+    }
+
+    std::vector<AtlasEntry> entries;
+    entries.reserve(entryCount);
+    for (u32 i = 0; i < entryCount; i++) {
+        const u8* entry = data.data() + HEADER_SIZE + i * ENTRY_SIZE;
+        const u16 page = LittleEndian::convertTo<u16>(entry + 4);
+        if (page >= pageCount) {
+            LOG_ERROR("Sprite atlas entry " + std::to_string(i) + " refers to missing page " + std::to_string(page));
+            return false;
+        }
+
+        entries.push_back(
+            {GenerateKey(LittleEndian::convertTo<u16>(entry), entry[2], entry[3] != 0),
+             page,
+             {LittleEndian::convertTo<u16>(entry + 6),
+              LittleEndian::convertTo<u16>(entry + 8),
+              LittleEndian::convertTo<u16>(entry + 10),
+              LittleEndian::convertTo<u16>(entry + 12)}}
+        );
+    }
+
+    // The packer writes entries sorted, but don't rely on it for the binary search
+    std::sort(entries.begin(), entries.end(), [](const AtlasEntry& a, const AtlasEntry& b) { return a.key < b.key; });
+
+    atlasEntries = std::move(entries);
+    atlasPages.assign(pageCount, nullptr);
+    atlasPageBasePath = indexPath.substr(0, indexPath.rfind('.'));
+    return true;
+}
+
+pu::sdl2::TextureHandle::Ref PokemonSpriteManager::GetAtlasPage(u16 page) {
+    if (page >= atlasPages.size()) {
+        return nullptr;
+    }
+
+    if (!atlasPages[page]) {
+        atlasPages[page] = LoadSpriteFromFile(AtlasPagePath(page));
+    }
+    return atlasPages[page];
+}
+
+std::string PokemonSpriteManager::AtlasPagePath(u16 page) {
+    return atlasPageBasePath + "_" + std::to_string(page) + ".png";
+}
+
 pu::sdl2::TextureHandle::Ref PokemonSpriteManager::LoadSpriteFromFile(const std::string& filePath) {
     // Load the texture using Plutonium's loading function
     SDL_Texture* texture = pu::ui::render::LoadImage(filePath);
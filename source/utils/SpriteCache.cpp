@@ -0,0 +1,182 @@
+#include "utils/SpriteCache.hpp"
+
+#include <algorithm>
+
+namespace pksm::utils {
+
+SpriteCache::SpriteCache(size_t budgetBytes) : budgetBytes(budgetBytes) {}
+
+pu::sdl2::TextureHandle::Ref SpriteCache::Get(u32 key) {
+    size_t slot = FindSlot(key);
+    if (slot == slots.size()) {
+        return nullptr;
+    }
+
+    const u32 entryIndex = slots[slot];
+    if (head != entryIndex) {
+        Unlink(entryIndex);
+        PushFront(entryIndex);
+    }
+    return entries[entryIndex].texture;
+}
+
+void SpriteCache::Put(u32 key, pu::sdl2::TextureHandle::Ref texture) {
+    const size_t bytes = TextureBytes(texture);
+
+    size_t slot = FindSlot(key);
+    if (slot != slots.size()) {
+        // Replace the existing texture
+        const u32 entryIndex = slots[slot];
+        Entry& entry = entries[entryIndex];
+        memoryUsage = memoryUsage - entry.bytes + bytes;
+        entry.texture = texture;
+        entry.bytes = bytes;
+        Unlink(entryIndex);
+        PushFront(entryIndex);
+    } else {
+        // Keep the table at most half full so probe sequences stay short
+        if ((count + 1) * 2 > slots.size()) {
+            Grow();
+        }
+
+        u32 entryIndex;
+        if (!freeEntries.empty()) {
+            entryIndex = freeEntries.back();
+            freeEntries.pop_back();
+            entries[entryIndex] = {key, texture, bytes, NONE, NONE};
+        } else {
+            entryIndex = static_cast<u32>(entries.size());
+            entries.push_back({key, texture, bytes, NONE, NONE});
+        }
+
+        InsertSlot(entryIndex);
+        PushFront(entryIndex);
+        count++;
+        memoryUsage += bytes;
+    }
+
+    Trim();
+}
+
+void SpriteCache::Clear() {
+    std::fill(slots.begin(), slots.end(), NONE);
+    entries.clear();
+    freeEntries.clear();
+    head = NONE;
+    tail = NONE;
+    count = 0;
+    memoryUsage = 0;
+}
+
+void SpriteCache::SetBudget(size_t budgetBytes) {
+    this->budgetBytes = budgetBytes;
+    Trim();
+}
+
+size_t SpriteCache::HomeSlot(u32 key) const {
+    // Fibonacci hashing spreads the packed keys, whose low bits are mostly form and shiny flags
+    return static_cast<size_t>((static_cast<u64>(key) * 0x9E3779B97F4A7C15ULL) >> 32) & (slots.size() - 1);
+}
+
+size_t SpriteCache::FindSlot(u32 key) const {
+    if (slots.empty()) {
+        return slots.size();
+    }
+
+    const size_t mask = slots.size() - 1;
+    for (size_t slot = HomeSlot(key); slots[slot] != NONE; slot = (slot + 1) & mask) {
+        if (entries[slots[slot]].key == key) {
+            return slot;
+        }
+    }
+    return slots.size();
+}
+
+void SpriteCache::Grow() {
+    slots.assign(std::max<size_t>(64, slots.size() * 2), NONE);
+    for (u32 entryIndex = head; entryIndex != NONE; entryIndex = entries[entryIndex].next) {
+        InsertSlot(entryIndex);
+    }
+}
+
+void SpriteCache::InsertSlot(u32 entryIndex) {
+    const size_t mask = slots.size() - 1;
+    size_t slot = HomeSlot(entries[entryIndex].key);
+    while (slots[slot] != NONE) {
+        slot = (slot + 1) & mask;
+    }
+    slots[slot] = entryIndex;
+}
+
+void SpriteCache::EraseSlot(size_t slot) {
+    // Backward shift deletion: pull later entries of the probe run into the hole so that lookups
+    // never need tombstones
+    const size_t mask = slots.size() - 1;
+    size_t hole = slot;
+    for (size_t next = (slot + 1) & mask; slots[next] != NONE; next = (next + 1) & mask) {
+        const size_t home = HomeSlot(entries[slots[next]].key);
+        if (((next - home) & mask) >= ((next - hole) & mask)) {
+            slots[hole] = slots[next];
+            hole = next;
+        }
+    }
+    slots[hole] = NONE;
+}
+
+void SpriteCache::Unlink(u32 entryIndex) {
+    Entry& entry = entries[entryIndex];
+    if (entry.prev != NONE) {
+        entries[entry.prev].next = entry.next;
+    } else {
+        head = entry.next;
+    }
+    if (entry.next != NONE) {
+        entries[entry.next].prev = entry.prev;
+    } else {
+        tail = entry.prev;
+    }
+    entry.prev = NONE;
+    entry.next = NONE;
+}
+
+void SpriteCache::PushFront(u32 entryIndex) {
+    Entry& entry = entries[entryIndex];
+    entry.prev = NONE;
+    entry.next = head;
+    if (head != NONE) {
+        entries[head].prev = entryIndex;
+    } else {
+        tail = entryIndex;
+    }
+    head = entryIndex;
+}
+
+void SpriteCache::Evict(u32 entryIndex) {
+    EraseSlot(FindSlot(entries[entryIndex].key));
+    Unlink(entryIndex);
+
+    Entry& entry = entries[entryIndex];
+    memoryUsage -= entry.bytes;
+    entry.texture = nullptr;
+    entry.bytes = 0;
+    freeEntries.push_back(entryIndex);
+    count--;
+}
+
+void SpriteCache::Trim() {
+    while (memoryUsage > budgetBytes && tail != head) {
+        Evict(tail);
+    }
+}
+
+size_t SpriteCache::TextureBytes(const pu::sdl2::TextureHandle::Ref& texture) {
+    if (!texture) {
+        return 0;
+    }
+
+    // Sprites are decoded to 32-bit RGBA textures
+    return static_cast<size_t>(pu::ui::render::GetTextureWidth(texture->Get())) *
+        static_cast<size_t>(pu::ui::render::GetTextureHeight(texture->Get())) * 4;
+}
+
+}  // namespace pksm::utils
@@ -0,0 +1,113 @@
+#include "utils/SpriteDecoder.hpp"
+
+#include <SDL2/SDL_image.h>
+#include <algorithm>
+
+#include "utils/Trace.hpp"
+
+namespace pksm::utils {
+
+SpriteDecoder::~SpriteDecoder() {
+    Stop();
+}
+
+void SpriteDecoder::Start() {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (worker.joinable()) {
+        return;
+    }
+
+    stopping = false;
+    worker = std::thread(&SpriteDecoder::WorkerLoop, this);
+}
+
+void SpriteDecoder::Stop() {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        stopping = true;
+    }
+    jobAvailable.notify_all();
+
+    if (worker.joinable()) {
+        worker.join();
+    }
+
+    std::lock_guard<std::mutex> lock(mutex);
+    for (auto& image : decoded) {
+        if (image.surface) {
+            SDL_FreeSurface(image.surface);
+        }
+    }
+    decoded.clear();
+    jobs.clear();
+    pending.clear();
+}
+
+void SpriteDecoder::Queue(u32 id, const std::string& path, bool urgent) {
+    {
+        std::lock_guard<std::mutex> lock(mutex);
+        if (!pending.insert(id).second) {
+            if (urgent) {
+                // Promote a prefetch that is now needed on screen
+                auto jobIt = std::find_if(jobs.begin(), jobs.end(), [id](const Job& job) { return job.id == id; });
+                if (jobIt != jobs.end() && jobIt != jobs.begin()) {
+                    Job job = std::move(*jobIt);
+                    jobs.erase(jobIt);
+                    jobs.push_front(std::move(job));
+                }
+            }
+            return;
+        }
+
+        if (urgent) {
+            jobs.push_front({id, path});
+        } else {
+            jobs.push_back({id, path});
+        }
+    }
+    jobAvailable.notify_one();
+}
+
+bool SpriteDecoder::TakeDecoded(DecodedImage& image) {
+    std::lock_guard<std::mutex> lock(mutex);
+    if (decoded.empty()) {
+        return false;
+    }
+
+    image = std::move(decoded.front());
+    decoded.pop_front();
+    pending.erase(image.id);
+    return true;
+}
+
+void SpriteDecoder::WorkerLoop() {
+    std::unique_lock<std::mutex> lock(mutex);
+    while (true) {
+        jobAvailable.wait(lock, [this]() { return stopping || !jobs.empty(); });
+        if (stopping) {
+            return;
+        }
+
+        Job job = std::move(jobs.front());
+        jobs.pop_front();
+
+        // Decode without holding the lock so the render thread can keep queueing and taking
+        lock.unlock();
+        SDL_Surface* surface = nullptr;
+        {
+            TRACE_SCOPE("SpriteDecoder::Decode");
+            surface = IMG_Load(job.path.c_str());
+        }
+        lock.lock();
+
+        if (stopping) {
+            if (surface) {
+                SDL_FreeSurface(surface);
+            }
+            return;
+        }
+        decoded.push_back({job.id, std::move(job.path), surface});
+    }
+}
+
+}  // namespace pksm::utils
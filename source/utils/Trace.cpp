@@ -0,0 +1,143 @@
+#include "utils/Trace.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <limits>
+#include <memory>
+#include <mutex>
+#include <vector>
+
+#include "utils/Logger.hpp"
+
+#ifdef PKSM_TRACE
+
+namespace pksm::utils {
+
+namespace {
+
+struct ThreadBuffer {
+    explicit ThreadBuffer(u32 threadIndex)
+      : threadIndex(threadIndex), events(std::make_unique<Tracer::Event[]>(Tracer::EVENTS_PER_THREAD)) {}
+
+    u32 threadIndex;
+    std::atomic<size_t> count = 0;
+    std::atomic<size_t> dropped = 0;
+    std::unique_ptr<Tracer::Event[]> events;
+};
+
+// Buffers are kept after their thread exits, so spans from finished workers still get exported
+std::mutex buffersMutex;
+std::vector<std::unique_ptr<ThreadBuffer>> buffers;
+
+thread_local ThreadBuffer* currentBuffer = nullptr;
+
+void WriteEscaped(FILE* file, const char* text) {
+    for (; *text; text++) {
+        if (*text == '"' || *text == '\\') {
+            std::fputc('\\', file);
+        }
+        std::fputc(*text, file);
+    }
+}
+
+// Chrome traces are in microseconds; keep the nanoseconds as a fraction
+void WriteMicroseconds(FILE* file, u64 nanoseconds) {
+    std::fprintf(
+        file,
+        "%llu.%03llu",
+        static_cast<unsigned long long>(nanoseconds / 1000),
+        static_cast<unsigned long long>(nanoseconds % 1000)
+    );
+}
+
+ThreadBuffer* CurrentThreadBuffer() {
+    if (!currentBuffer) {
+        std::lock_guard<std::mutex> lock(buffersMutex);
+        buffers.push_back(std::make_unique<ThreadBuffer>(static_cast<u32>(buffers.size() + 1)));
+        currentBuffer = buffers.back().get();
+    }
+    return currentBuffer;
+}
+
+}  // namespace
+
+u64 Tracer::Now() {
+    const auto now = std::chrono::steady_clock::now().time_since_epoch();
+    return static_cast<u64>(std::chrono::duration_cast<std::chrono::nanoseconds>(now).count());
+}
+
+void Tracer::Record(const char* name, u64 start, u64 end) {
+    ThreadBuffer* buffer = CurrentThreadBuffer();
+
+    // Only this thread writes to its buffer, so the count just has to publish the new event
+    const size_t index = buffer->count.load(std::memory_order_relaxed);
+    if (index >= EVENTS_PER_THREAD) {
+        buffer->dropped.fetch_add(1, std::memory_order_relaxed);
+        return;
+    }
+    buffer->events[index] = Event{name, start, end};
+    buffer->count.store(index + 1, std::memory_order_release);
+}
+
+bool Tracer::WriteChromeTrace(const std::string& path) {
+    std::lock_guard<std::mutex> lock(buffersMutex);
+
+    // Take each buffer's count once, so spans finishing during the export are consistently left out.
+    // Timestamps are written relative to the first span.
+    std::vector<size_t> counts;
+    counts.reserve(buffers.size());
+    u64 origin = std::numeric_limits<u64>::max();
+    for (const auto& buffer : buffers) {
+        counts.push_back(buffer->count.load(std::memory_order_acquire));
+        for (size_t i = 0; i < counts.back(); i++) {
+            origin = std::min(origin, buffer->events[i].start);
+        }
+    }
+
+    FILE* file = std::fopen(path.c_str(), "w");
+    if (!file) {
+        LOG_ERROR("Failed to open trace file: " + path);
+        return false;
+    }
+
+    size_t written = 0;
+    size_t dropped = 0;
+    std::fputs("{\"displayTimeUnit\":\"ms\",\"traceEvents\":[", file);
+    for (size_t b = 0; b < buffers.size(); b++) {
+        const auto& buffer = buffers[b];
+        for (size_t i = 0; i < counts[b]; i++) {
+            const Event& event = buffer->events[i];
+            std::fputs((written > 0) ? ",\n{\"name\":\"" : "\n{\"name\":\"", file);
+            WriteEscaped(file, event.name);
+            std::fprintf(
+                file,
+                "\",\"ph\":\"X\",\"pid\":1,\"tid\":%u,\"ts\":",
+                static_cast<unsigned>(buffer->threadIndex)
+            );
+            WriteMicroseconds(file, event.start - origin);
+            std::fputs(",\"dur\":", file);
+            WriteMicroseconds(file, event.end - event.start);
+            std::fputc('}', file);
+            written++;
+        }
+        dropped += buffer->dropped.load(std::memory_order_relaxed);
+    }
+    std::fputs("\n]}\n", file);
+
+    if (std::fclose(file) != 0) {
+        LOG_ERROR("Failed to write trace file: " + path);
+        return false;
+    }
+
+    LOG_INFOF("Wrote {} trace spans from {} threads to {}", written, buffers.size(), path);
+    if (dropped > 0) {
+        LOG_WARNINGF("{} trace spans were dropped because their thread's buffer was full", dropped);
+    }
+    return true;
+}
+
+}  // namespace pksm::utils
+
+#endif
@@ -0,0 +1,283 @@
+#include "utils/ZipReader.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <zlib.h>
+
+#include "pksmcore/utils/endian.hpp"
+#include "utils/Logger.hpp"
+
+namespace pksm::utils {
+
+namespace {
+
+constexpr u32 LOCAL_HEADER_SIGNATURE = 0x04034b50;
+constexpr u32 CENTRAL_HEADER_SIGNATURE = 0x02014b50;
+constexpr u32 END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06054b50;
+constexpr u32 ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE = 0x06064b50;
+constexpr u32 ZIP64_LOCATOR_SIGNATURE = 0x07064b50;
+
+constexpr size_t LOCAL_HEADER_SIZE = 30;
+constexpr size_t CENTRAL_HEADER_SIZE = 46;
+constexpr size_t END_OF_CENTRAL_DIRECTORY_SIZE = 22;
+constexpr size_t ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE = 56;
+constexpr size_t ZIP64_LOCATOR_SIZE = 20;
+constexpr size_t MAX_COMMENT_SIZE = 0xFFFF;
+
+constexpr u16 ZIP64_EXTRA_FIELD_ID = 0x0001;
+constexpr u16 FLAG_ENCRYPTED = 0x0001;
+
+// Central directories bigger than this are not save backups
+constexpr u64 MAX_CENTRAL_DIRECTORY_SIZE = 16 * 1024 * 1024;
+
+}  // namespace
+
+std::string ZipReader::MakeEntryPath(const std::string& archivePath, const std::string& entryName) {
+    return archivePath + ENTRY_SEPARATOR + entryName;
+}
+
+bool ZipReader::SplitEntryPath(const std::string& path, std::string& archivePath, std::string& entryName) {
+    static const std::string marker = std::string(".zip") + ENTRY_SEPARATOR;
+    const size_t markerPos = path.find(marker);
+    if (markerPos == std::string::npos) {
+        return false;
+    }
+
+    archivePath = path.substr(0, markerPos + marker.size() - 1);
+    entryName = path.substr(markerPos + marker.size());
+    return !entryName.empty();
+}
+
+bool ZipReader::Open(const std::string& path) {
+    entries.clear();
+    file.close();
+    file.clear();
+    this->path = path;
+
+    file.open(path, std::ios::binary | std::ios::ate);
+    if (!file.is_open()) {
+        LOG_ERROR("Failed to open zip file: " + path);
+        return false;
+    }
+    fileSize = static_cast<u64>(file.tellg());
+
+    // The end of central directory record sits at the end, followed only by the archive comment
+    const size_t tailSize = static_cast<size_t>(std::min<u64>(fileSize, END_OF_CENTRAL_DIRECTORY_SIZE + MAX_COMMENT_SIZE));
+    if (tailSize < END_OF_CENTRAL_DIRECTORY_SIZE) {
+        LOG_ERROR("Not a zip file: " + path);
+        return false;
+    }
+
+    std::vector<u8> tail(tailSize);
+    if (!ReadAt(fileSize - tailSize, tail.data(), tailSize)) {
+        return false;
+    }
+
+    size_t recordPos = tailSize - END_OF_CENTRAL_DIRECTORY_SIZE + 1;
+    do {
+        recordPos--;
+        if (LittleEndian::convertTo<u32>(tail.data() + recordPos) == END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            break;
+        }
+    } while (recordPos > 0);
+    if (LittleEndian::convertTo<u32>(tail.data() + recordPos) != END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+        LOG_ERROR("Zip end of central directory not found: " + path);
+        return false;
+    }
+
+    const u8* record = tail.data() + recordPos;
+    u64 entryCount = LittleEndian::convertTo<u16>(record + 10);
+    u64 directorySize = LittleEndian::convertTo<u32>(record + 12);
+    u64 directoryOffset = LittleEndian::convertTo<u32>(record + 16);
+
+    if (entryCount == 0xFFFF || directorySize == 0xFFFFFFFF || directoryOffset == 0xFFFFFFFF) {
+        // ZIP64: the real values are in a record found through the locator right before this one
+        const u64 recordOffset = fileSize - tailSize + recordPos;
+        u8 locator[ZIP64_LOCATOR_SIZE];
+        u8 zip64Record[ZIP64_END_OF_CENTRAL_DIRECTORY_SIZE];
+        if (recordOffset < ZIP64_LOCATOR_SIZE || !ReadAt(recordOffset - ZIP64_LOCATOR_SIZE, locator, sizeof(locator)) ||
+            LittleEndian::convertTo<u32>(locator) != ZIP64_LOCATOR_SIGNATURE ||
+            !ReadAt(LittleEndian::convertTo<u64>(locator + 8), zip64Record, sizeof(zip64Record)) ||
+            LittleEndian::convertTo<u32>(zip64Record) != ZIP64_END_OF_CENTRAL_DIRECTORY_SIGNATURE) {
+            LOG_ERROR("Invalid zip64 end of central directory: " + path);
+            return false;
+        }
+        entryCount = LittleEndian::convertTo<u64>(zip64Record + 32);
+        directorySize = LittleEndian::convertTo<u64>(zip64Record + 40);
+        directoryOffset = LittleEndian::convertTo<u64>(zip64Record + 48);
+    }
+
+    if (directorySize > MAX_CENTRAL_DIRECTORY_SIZE || directoryOffset > fileSize ||
+        directorySize > fileSize - directoryOffset) {
+        LOG_ERROR("Invalid zip central directory: " + path);
+        return false;
+    }
+
+    return ReadCentralDirectory(directoryOffset, directorySize, entryCount);
+}
+
+const ZipReader::Entry* ZipReader::Find(const std::string& name) const {
+    auto entryIt = std::find_if(entries.begin(), entries.end(), [&name](const Entry& entry) {
+        return entry.name == name;
+    });
+    return (entryIt != entries.end()) ? &*entryIt : nullptr;
+}
+
+bool ZipReader::Extract(const Entry& entry, u8* out) {
+    if (entry.flags & FLAG_ENCRYPTED) {
+        LOG_ERROR("Encrypted zip entries are not supported: " + entry.name);
+        return false;
+    }
+    if (entry.method != METHOD_STORED && entry.method != METHOD_DEFLATED) {
+        LOG_ERROR("Unsupported zip compression method " + std::to_string(entry.method) + ": " + entry.name);
+        return false;
+    }
+
+    // The local header repeats the name and may have a different extra field, so its size is read again
+    u8 localHeader[LOCAL_HEADER_SIZE];
+    if (!ReadAt(entry.localHeaderOffset, localHeader, sizeof(localHeader)) ||
+        LittleEndian::convertTo<u32>(localHeader) != LOCAL_HEADER_SIGNATURE) {
+        LOG_ERROR("Invalid zip local header: " + entry.name);
+        return false;
+    }
+    const u64 dataOffset = entry.localHeaderOffset + LOCAL_HEADER_SIZE + LittleEndian::convertTo<u16>(localHeader + 26) +
+        LittleEndian::convertTo<u16>(localHeader + 28);
+    if (dataOffset > fileSize || entry.compressedSize > fileSize - dataOffset) {
+        LOG_ERROR("Zip entry data out of range: " + entry.name);
+        return false;
+    }
+
+    if (entry.method == METHOD_STORED) {
+        if (entry.compressedSize != entry.uncompressedSize || !ReadAt(dataOffset, out, entry.uncompressedSize)) {
+            LOG_ERROR("Failed to read stored zip entry: " + entry.name);
+            return false;
+        }
+    } else {
+        z_stream stream{};
+        if (inflateInit2(&stream, -MAX_WBITS) != Z_OK) {
+            LOG_ERROR("Failed to initialize inflate");
+            return false;
+        }
+
+        std::vector<u8> chunk(READ_CHUNK_SIZE);
+        u64 compressedLeft = entry.compressedSize;
+        u64 written = 0;
+        int status = Z_OK;
+
+        file.clear();
+        file.seekg(static_cast<std::streamoff>(dataOffset));
+        while (status != Z_STREAM_END && compressedLeft > 0) {
+            const size_t readSize = static_cast<size_t>(std::min<u64>(chunk.size(), compressedLeft));
+            if (!file.read(reinterpret_cast<char*>(chunk.data()), readSize)) {
+                break;
+            }
+            compressedLeft -= readSize;
+
+            stream.next_in = chunk.data();
+            stream.avail_in = static_cast<uInt>(readSize);
+            do {
+                // Inflate straight into the caller's buffer; no intermediate copy
+                stream.next_out = out + written;
+                stream.avail_out =
+                    static_cast<uInt>(std::min<u64>(entry.uncompressedSize - written, std::numeric_limits<uInt>::max()));
+                const uInt outBefore = stream.avail_out;
+                status = inflate(&stream, Z_NO_FLUSH);
+                written += outBefore - stream.avail_out;
+            } while (status == Z_OK && stream.avail_in > 0 && written < entry.uncompressedSize);
+
+            if (status != Z_OK && status != Z_STREAM_END) {
+                break;
+            }
+        }
+        inflateEnd(&stream);
+
+        if (status != Z_STREAM_END || written != entry.uncompressedSize) {
+            LOG_ERROR("Failed to inflate zip entry: " + entry.name);
+            return false;
+        }
+    }
+
+    if (crc32_z(0, out, entry.uncompressedSize) != entry.crc32) {
+        LOG_ERROR("CRC mismatch in zip entry: " + entry.name);
+        return false;
+    }
+    return true;
+}
+
+bool ZipReader::ReadAt(u64 offset, u8* out, size_t size) {
+    file.clear();
+    file.seekg(static_cast<std::streamoff>(offset));
+    if (!file.read(reinterpret_cast<char*>(out), static_cast<std::streamsize>(size))) {
+        LOG_ERROR("Failed to read from zip file: " + path);
+        return false;
+    }
+    return true;
+}
+
+bool ZipReader::ReadCentralDirectory(u64 offset, u64 size, u64 entryCount) {
+    std::vector<u8> directory(static_cast<size_t>(size));
+    if (!ReadAt(offset, directory.data(), directory.size())) {
+        return false;
+    }
+
+    size_t pos = 0;
+    for (u64 i = 0; i < entryCount; i++) {
+        if (directory.size() - pos < CENTRAL_HEADER_SIZE ||
+            LittleEndian::convertTo<u32>(directory.data() + pos) != CENTRAL_HEADER_SIGNATURE) {
+            LOG_ERROR("Invalid zip central directory entry in " + path);
+            entries.clear();
+            return false;
+        }
+
+        const u8* header = directory.data() + pos;
+        const size_t nameLength = LittleEndian::convertTo<u16>(header + 28);
+        const size_t extraLength = LittleEndian::convertTo<u16>(header + 30);
+        const size_t commentLength = LittleEndian::convertTo<u16>(header + 32);
+        if (directory.size() - pos - CENTRAL_HEADER_SIZE < nameLength + extraLength + commentLength) {
+            LOG_ERROR("Truncated zip central directory in " + path);
+            entries.clear();
+            return false;
+        }
+
+        Entry entry{
+            std::string(reinterpret_cast<const char*>(header + CENTRAL_HEADER_SIZE), nameLength),
+            LittleEndian::convertTo<u16>(header + 10),
+            LittleEndian::convertTo<u16>(header + 8),
+            LittleEndian::convertTo<u32>(header + 16),
+            LittleEndian::convertTo<u32>(header + 20),
+            LittleEndian::convertTo<u32>(header + 24),
+            LittleEndian::convertTo<u32>(header + 42),
+        };
+
+        // ZIP64 extra field: 64-bit values for the fields set to 0xFFFFFFFF, in this order
+        const u8* extra = header + CENTRAL_HEADER_SIZE + nameLength;
+        for (size_t extraPos = 0; extraPos + 4 <= extraLength;) {
+            const u16 fieldId = LittleEndian::convertTo<u16>(extra + extraPos);
+            const size_t fieldSize = LittleEndian::convertTo<u16>(extra + extraPos + 2);
+            const u8* field = extra + extraPos + 4;
+            extraPos += 4 + fieldSize;
+            if (fieldId != ZIP64_EXTRA_FIELD_ID || extraPos > extraLength) {
+                continue;
+            }
+
+            size_t fieldPos = 0;
+            for (u64* value : {&entry.uncompressedSize, &entry.compressedSize, &entry.localHeaderOffset}) {
+                if (*value == 0xFFFFFFFF && fieldPos + 8 <= fieldSize) {
+                    *value = LittleEndian::convertTo<u64>(field + fieldPos);
+                    fieldPos += 8;
+                }
+            }
+        }
+
+        pos += CENTRAL_HEADER_SIZE + nameLength + extraLength + commentLength;
+
+        // Directories have no data
+        if (!entry.name.empty() && entry.name.back() != '/') {
+            entries.push_back(std::move(entry));
+        }
+    }
+
+    return true;
+}
+
+}  // namespace pksm::utils
@@ -0,0 +1,148 @@
+// Checks that ApplicationRecordCache lists installed applications only when they may have changed
+// and that filtering keeps just the supported titles, and times filtering with and without the
+// cache. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -DNDEBUG -Iinclude -Itests/host -o ApplicationRecordCacheTest
+//       tests/ApplicationRecordCacheTest.cpp source/data/providers/ApplicationRecordCache.cpp
+//   ./ApplicationRecordCacheTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "data/providers/ApplicationRecordCache.hpp"
+#include "data/providers/mock/MockApplicationRecordSource.hpp"
+#include "TestHelpers.hpp"
+
+using pksm::titles::ApplicationRecordCache;
+using pksm::tests::MicrosecondsSince;
+
+namespace {
+
+// Stands in for a catalogue title; only the id matters to the cache
+struct SupportedTitle {
+    u64 titleId;
+    std::string name;
+};
+
+constexpr u64 SWORD = 0x0100ABF008968000;
+constexpr u64 SHIELD = 0x01008DB008C2C000;
+constexpr u64 SCARLET = 0x0100A3D008C5C000;
+constexpr u64 VIOLET = 0x01008F6008C5E000;
+constexpr u64 OTHER_GAME = 0x0100000000010000;
+constexpr u64 ANOTHER_GAME = 0x0100000000020000;
+
+const std::vector<SupportedTitle> CATALOGUE = {
+    {SWORD, "Sword"},
+    {SHIELD, "Shield"},
+    {SCARLET, "Scarlet"},
+    {VIOLET, "Violet"},
+};
+
+u64 GetTitleId(const SupportedTitle& title) {
+    return title.titleId;
+}
+
+std::vector<u64> FilteredIds(ApplicationRecordCache& cache, const std::vector<SupportedTitle>& titles) {
+    std::vector<u64> ids;
+    for (const auto& title : cache.FilterInstalled(titles, GetTitleId)) {
+        ids.push_back(title.titleId);
+    }
+    return ids;
+}
+
+void TestFiltering() {
+    const std::vector<u64> installed = {OTHER_GAME, VIOLET, SWORD, ANOTHER_GAME};
+    auto source = std::make_shared<MockApplicationRecordSource>(installed);
+    ApplicationRecordCache cache(source);
+
+    // Installed applications that aren't supported are dropped, and catalogue order is kept
+    CHECK(FilteredIds(cache, CATALOGUE) == (std::vector<u64>{SWORD, VIOLET}));
+    CHECK(cache.IsInstalled(OTHER_GAME));
+    CHECK(!cache.IsInstalled(SHIELD));
+
+    // Without any record source nothing counts as installed
+    ApplicationRecordCache noSource(nullptr);
+    CHECK(FilteredIds(noSource, CATALOGUE).empty());
+}
+
+void TestRefreshes() {
+    auto source = std::make_shared<MockApplicationRecordSource>(std::vector<u64>{SWORD});
+    ApplicationRecordCache cache(source);
+
+    CHECK(FilteredIds(cache, CATALOGUE) == (std::vector<u64>{SWORD}));
+    CHECK(source->GetListCount() == 1);
+
+    // Reused while the sequence stays the same
+    CHECK(FilteredIds(cache, CATALOGUE) == (std::vector<u64>{SWORD}));
+    CHECK(cache.IsInstalled(SWORD));
+    CHECK(source->GetListCount() == 1);
+
+    // Installing a game moves the sequence
+    source->SetApplicationIds({SWORD, SCARLET});
+    CHECK(FilteredIds(cache, CATALOGUE) == (std::vector<u64>{SWORD, SCARLET}));
+    CHECK(source->GetListCount() == 2);
+    CHECK(cache.IsInstalled(SCARLET));
+    CHECK(source->GetListCount() == 2);
+
+    // Invalidate lists again even though the sequence didn't move
+    cache.Invalidate();
+    CHECK(FilteredIds(cache, CATALOGUE) == (std::vector<u64>{SWORD, SCARLET}));
+    CHECK(source->GetListCount() == 3);
+
+    source->SetApplicationIds({});
+    CHECK(FilteredIds(cache, CATALOGUE).empty());
+    CHECK(source->GetListCount() == 4);
+}
+
+// Filtering the catalogue on a console with many applications, served from the cache and with the
+// records listed on every query as before the cache
+void BenchmarkFiltering() {
+    constexpr size_t INSTALLED_COUNT = 500;
+    constexpr int QUERIES = 1000;
+
+    std::vector<u64> installed;
+    for (size_t i = 0; i < INSTALLED_COUNT; i++) {
+        installed.push_back(OTHER_GAME + (static_cast<u64>(i) << 16));
+    }
+    installed.push_back(SWORD);
+    installed.push_back(VIOLET);
+    auto source = std::make_shared<MockApplicationRecordSource>(installed);
+    ApplicationRecordCache cache(source);
+
+    size_t found = 0;
+    auto start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; i++) {
+        found += cache.FilterInstalled(CATALOGUE, GetTitleId).size();
+    }
+    const double cached = MicrosecondsSince(start);
+
+    start = std::chrono::steady_clock::now();
+    for (int i = 0; i < QUERIES; i++) {
+        cache.Invalidate();
+        found += cache.FilterInstalled(CATALOGUE, GetTitleId).size();
+    }
+    const double uncached = MicrosecondsSince(start);
+    CHECK(found == 2 * 2 * QUERIES);
+
+    std::printf(
+        "Filtering %zu supported titles against %zu installed applications:\n",
+        CATALOGUE.size(),
+        installed.size()
+    );
+    std::printf("  cached            %8.2f us per query\n", cached / QUERIES);
+    std::printf("  listed each query %8.2f us per query (in-memory source; ns is slower)\n", uncached / QUERIES);
+}
+
+}  // namespace
+
+int main() {
+    TestFiltering();
+    TestRefreshes();
+    BenchmarkFiltering();
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,149 @@
+// Checks that BackupIndex notices added, removed and renamed backups, and times indexing a tree of
+// 10,000 backups and rescanning it unchanged. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -DNDEBUG -Iinclude -Iinclude/pksmcore -Itests/host -o BackupIndexTest tests/BackupIndexTest.cpp
+//       source/data/saves/BackupIndex.cpp source/utils/ZipReader.cpp -lz -pthread
+//   ./BackupIndexTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <set>
+#include <string>
+#include <vector>
+
+#include "data/saves/BackupIndex.hpp"
+#include "TestHelpers.hpp"
+
+using pksm::saves::BackupIndex;
+using pksm::tests::MicrosecondsSince;
+namespace fs = std::filesystem;
+
+namespace {
+
+// 10,000 backups: two roots laid out like Checkpoint and JKSV, 100 titles each, 50 backups a title
+constexpr size_t TITLES_PER_ROOT = 100;
+constexpr size_t BACKUPS_PER_TITLE = 50;
+constexpr u64 FIRST_TITLE_ID = 0x0100000000010000;
+
+u64 TitleId(size_t index) {
+    return FIRST_TITLE_ID + (static_cast<u64>(index) << 16);
+}
+
+std::string TitleFolderName(size_t index) {
+    char name[64];
+    std::snprintf(name, sizeof(name), "%016llX Game %zu", static_cast<unsigned long long>(TitleId(index)), index);
+    return name;
+}
+
+void CreateBackup(const fs::path& path) {
+    fs::create_directories(path);
+    std::ofstream(path / "main", std::ios::binary) << std::string(64, 'x');
+}
+
+void CreateTree(const fs::path& root) {
+    for (const char* manager : {"Checkpoint", "JKSV"}) {
+        for (size_t title = 0; title < TITLES_PER_ROOT; title++) {
+            const fs::path folder = root / manager / TitleFolderName(title);
+            for (size_t backup = 0; backup < BACKUPS_PER_TITLE; backup++) {
+                CreateBackup(folder / ("2024-01-01 backup " + std::to_string(backup)));
+            }
+        }
+    }
+}
+
+std::set<std::string> BackupNames(const BackupIndex& index, u64 titleId) {
+    std::set<std::string> names;
+    for (const auto& backup : index.GetBackups(titleId)) {
+        names.insert(backup.name);
+    }
+    return names;
+}
+
+// Refresh and wait, returning the time the scan took in microseconds
+double Scan(BackupIndex& index) {
+    const auto start = std::chrono::steady_clock::now();
+    index.Refresh();
+    index.WaitForScan();
+    return MicrosecondsSince(start);
+}
+
+void TestTitleIds() {
+    CHECK(pksm::saves::ParseBackupFolderTitleId("0100ABF008968000 Pokemon Sword") == 0x0100ABF008968000);
+    CHECK(pksm::saves::ParseBackupFolderTitleId("Pokemon Sword [0100abf008968000]") == 0x0100ABF008968000);
+    CHECK(pksm::saves::ParseBackupFolderTitleId("Pokemon Sword") == 0);
+    CHECK(pksm::saves::ParseBackupFolderTitleId("0100ABF0089680001 too long") == 0);
+}
+
+void TestIndex(const fs::path& root) {
+    BackupIndex index({{(root / "Checkpoint").string(), "[Backup]"}, {(root / "JKSV").string(), "[JKSV]"}});
+    std::set<u64> updated;
+    index.SetListener([&updated](u64 titleId) { updated.insert(titleId); });
+
+    const double firstScan = Scan(index);
+    index.ProcessUpdates();
+    CHECK(updated.size() == TITLES_PER_ROOT);
+
+    const auto backups = index.GetBackups(TitleId(0));
+    CHECK(backups.size() == 2 * BACKUPS_PER_TITLE);
+    CHECK(!backups.empty() && backups.front().label == "[Backup]" && backups.back().label == "[JKSV]");
+    CHECK(!backups.empty() && backups.front().HasFile("main") && !backups.front().isZip);
+
+    // Nothing changed, so no title is reported again
+    updated.clear();
+    const double rescan = Scan(index);
+    index.ProcessUpdates();
+    CHECK(updated.empty());
+
+    const fs::path folder = root / "JKSV" / TitleFolderName(1);
+    const u64 titleId = TitleId(1);
+
+    CreateBackup(folder / "added");
+    Scan(index);
+    index.ProcessUpdates();
+    CHECK(BackupNames(index, titleId).count("added") == 1);
+    CHECK(index.GetBackups(titleId).size() == 2 * BACKUPS_PER_TITLE + 1);
+    CHECK(updated.size() == 1 && updated.count(titleId) == 1);
+
+    fs::rename(folder / "added", folder / "renamed");
+    Scan(index);
+    CHECK(BackupNames(index, titleId).count("added") == 0);
+    CHECK(BackupNames(index, titleId).count("renamed") == 1);
+
+    fs::remove_all(folder / "renamed");
+    Scan(index);
+    CHECK(BackupNames(index, titleId).count("renamed") == 0);
+    CHECK(index.GetBackups(titleId).size() == 2 * BACKUPS_PER_TITLE);
+
+    // A title folder that disappears takes its backups with it
+    fs::remove_all(folder);
+    Scan(index);
+    CHECK(index.GetBackups(titleId).size() == BACKUPS_PER_TITLE);
+
+    // Listing every backup again, which is what each refresh cost before the index kept its results
+    BackupIndex fresh({{(root / "Checkpoint").string(), "[Backup]"}, {(root / "JKSV").string(), "[JKSV]"}});
+    const double fullScan = Scan(fresh);
+
+    const size_t total = 2 * TITLES_PER_ROOT * BACKUPS_PER_TITLE;
+    std::printf("Backup index over %zu backups in %zu title folders:\n", total, 2 * TITLES_PER_ROOT);
+    std::printf("  first scan        %9.0f us\n", firstScan);
+    std::printf("  unchanged rescan  %9.0f us\n", rescan);
+    std::printf("  full rescan       %9.0f us\n", fullScan);
+}
+
+}  // namespace
+
+int main() {
+    const fs::path root = fs::temp_directory_path() / "pksm_backup_index_test";
+    fs::remove_all(root);
+    CreateTree(root);
+
+    TestTitleIds();
+    TestIndex(root);
+
+    fs::remove_all(root);
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,106 @@
+// Checks FormatLogMessage's output and measures what a log call costs when its level is disabled,
+// against building the message anyway as the LOG_ macros used to. Build without NDEBUG, which
+// compiles logging out. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -O2 -Iinclude -Itests/host -o LogFormatTest tests/LogFormatTest.cpp
+//       source/utils/Logger.cpp source/utils/LogRing.cpp source/utils/LogFormat.cpp -pthread
+//   ./LogFormatTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <algorithm>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <string_view>
+
+#include "TestHelpers.hpp"
+#include "utils/LogFormat.hpp"
+#include "utils/Logger.hpp"
+
+using pksm::tests::MicrosecondsSince;
+using pksm::utils::Logger;
+using pksm::utils::LogArg;
+
+namespace {
+
+constexpr size_t ITERATIONS = 10000000;
+
+template <typename... Args>
+std::string Format(std::string_view format, const Args&... args) {
+    char message[Logger::MAX_MESSAGE_SIZE];
+    const size_t length = pksm::utils::FormatLogMessage(message, sizeof(message), format, {LogArg(args)...});
+    return std::string(message, std::min(length, sizeof(message)));
+}
+
+void TestFormat() {
+    CHECK(Format("Loaded {} titles in {}ms", 12, 3.5) == "Loaded 12 titles in 3.5ms");
+    CHECK(Format("{} {} {}", -7, 7u, static_cast<u64>(18446744073709551615ull)) == "-7 7 18446744073709551615");
+    CHECK(Format("{:x} {:016x}", 255, static_cast<u64>(0x0100ABCD)) == "ff 000000000100abcd");
+    CHECK(Format("[{:4}] [{:04}]", 42, -42) == "[  42] [-042]");
+    CHECK(Format("{} {}", true, false) == "true false");
+    CHECK(Format("{} {} {}", "text", std::string("string"), std::string_view("view")) == "text string view");
+    CHECK(Format("{}", static_cast<const char*>(nullptr)) == "(null)");
+    CHECK(Format("{}", reinterpret_cast<const void*>(0x1234)) == "0x1234");
+    CHECK(Format("{{}} {{{}}}", 1) == "{} {1}");
+    CHECK(Format("{} {}", 1) == "1 {?}");
+    CHECK(Format("stray } and unclosed {") == "stray } and unclosed {");
+
+    // The whole length is returned even when the message is cut off
+    char small[8];
+    const std::string longArg(100, 'x');
+    CHECK(pksm::utils::FormatLogMessage(small, sizeof(small), "id {}", {LogArg(longArg)}) == 103);
+    CHECK(std::string_view(small, sizeof(small)) == "id xxxxx");
+}
+
+// Keeps the compiler from dropping the eager baseline's work
+size_t sink = 0;
+
+void TestDisabledCost(std::FILE* logFile) {
+    // Debug is off while Info and above are written
+    Logger::Initialize(logFile);
+    Logger::SetLevel(Logger::Level::Info);
+    CHECK(!Logger::IsEnabled(Logger::Level::Debug));
+    CHECK(Logger::IsEnabled(Logger::Level::Info));
+
+    auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        LOG_DEBUG("Selected slot " + std::to_string(i) + " in box " + std::to_string(i % 32));
+    }
+    const double concatenated = MicrosecondsSince(start) * 1000.0 / ITERATIONS;
+
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        LOG_DEBUGF("Selected slot {} in box {}", i, i % 32);
+    }
+    const double formatted = MicrosecondsSince(start) * 1000.0 / ITERATIONS;
+
+    // What a disabled call cost when the message was built before the level was looked at
+    start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < ITERATIONS; i++) {
+        const std::string message = "Selected slot " + std::to_string(i) + " in box " + std::to_string(i % 32);
+        sink += message.size();
+        Logger::Debug(message);
+    }
+    const double eager = MicrosecondsSince(start) * 1000.0 / ITERATIONS;
+    Logger::Finalize();
+
+    std::printf("Disabled LOG_DEBUG call, %zu iterations:\n", ITERATIONS);
+    std::printf("  LOG_DEBUG with concatenation %6.1f ns\n", concatenated);
+    std::printf("  LOG_DEBUGF                   %6.1f ns\n", formatted);
+    std::printf("  message built regardless     %6.1f ns\n", eager);
+}
+
+}  // namespace
+
+int main() {
+    TestFormat();
+
+    std::FILE* logFile = std::tmpfile();
+    CHECK(logFile != nullptr);
+    if (logFile) {
+        TestDisabledCost(logFile);
+        std::fclose(logFile);
+    }
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,259 @@
+// Checks that LogRing keeps records in order, drops and counts them when full, and loses nothing
+// with several producers, then measures how long a log call takes to enqueue compared with the old
+// format-and-write on the calling thread. Build without NDEBUG, which compiles logging out. Runs on
+// a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -O2 -Iinclude -Itests/host -o LoggerTest tests/LoggerTest.cpp
+//       source/utils/Logger.cpp source/utils/LogRing.cpp source/utils/LogFormat.cpp -pthread
+//   ./LoggerTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <algorithm>
+#include <atomic>
+#include <chrono>
+#include <cstdio>
+#include <cstring>
+#include <ctime>
+#include <filesystem>
+#include <fstream>
+#include <iomanip>
+#include <sstream>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestHelpers.hpp"
+#include "utils/LogRing.hpp"
+#include "utils/Logger.hpp"
+
+using pksm::utils::LogRing;
+using pksm::utils::Logger;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t PRODUCER_COUNT = 4;
+constexpr size_t PUSHES_PER_PRODUCER = 100000;
+
+// Calls are made in bursts the writer can keep up with, so the timings are of queueing rather than
+// of dropping
+constexpr size_t LATENCY_CALLS = 100000;
+constexpr size_t BURST_SIZE = 250;
+constexpr std::chrono::milliseconds BURST_PAUSE{3};
+
+bool Push(LogRing& ring, const std::string& text) {
+    return ring.TryPush(0, 0, text.data(), text.size());
+}
+
+void TestRing() {
+    // Rounded up to 8 slots
+    LogRing ring(5);
+    for (int i = 0; i < 8; i++) {
+        CHECK(Push(ring, "message " + std::to_string(i)));
+    }
+    CHECK(!Push(ring, "dropped"));
+    CHECK(ring.TakeDropped() == 1);
+    CHECK(ring.TakeDropped() == 0);
+
+    std::vector<std::string> drained;
+    const auto collect = [&drained](const LogRing::Record& record) {
+        drained.emplace_back(record.text, record.length);
+    };
+    CHECK(ring.Drain(collect, 3) == 3);
+    CHECK(ring.Drain(collect, 100) == 5);
+    CHECK(ring.Drain(collect, 100) == 0);
+    CHECK(drained.size() == 8);
+    for (size_t i = 0; i < drained.size(); i++) {
+        CHECK(drained[i] == "message " + std::to_string(i));
+    }
+
+    // Long messages are cut off and marked
+    const std::string longText(LogRing::TEXT_SIZE + 100, 'x');
+    CHECK(Push(ring, longText));
+    ring.Drain(
+        [](const LogRing::Record& record) {
+            CHECK(record.truncated);
+            CHECK(record.length == LogRing::TEXT_SIZE);
+        },
+        1
+    );
+}
+
+// Every producer numbers its records and retries them until they fit. The consumer checks that each
+// producer's records all arrive, in order, and that every failed push was counted as dropped.
+void TestProducers() {
+    LogRing ring(512);
+    std::atomic<size_t> running{PRODUCER_COUNT};
+    std::atomic<u64> retries{0};
+    std::vector<std::thread> producers;
+    for (size_t p = 0; p < PRODUCER_COUNT; p++) {
+        producers.emplace_back([&ring, &running, &retries, p]() {
+            char text[32];
+            for (size_t i = 0; i < PUSHES_PER_PRODUCER; i++) {
+                const int length = std::snprintf(text, sizeof(text), "%zu %zu", p, i);
+                while (!ring.TryPush(i, 0, text, static_cast<size_t>(length))) {
+                    retries.fetch_add(1, std::memory_order_relaxed);
+                    std::this_thread::yield();
+                }
+            }
+            running.fetch_sub(1, std::memory_order_release);
+        });
+    }
+
+    std::vector<long long> lastSeen(PRODUCER_COUNT, -1);
+    size_t received = 0;
+    bool ordered = true;
+    const auto consume = [&](const LogRing::Record& record) {
+        size_t producer = 0;
+        long long index = 0;
+        // Record text isn't terminated
+        const std::string text(record.text, record.length);
+        std::sscanf(text.c_str(), "%zu %lld", &producer, &index);
+        ordered = ordered && producer < PRODUCER_COUNT && index == lastSeen[producer] + 1 &&
+            static_cast<u64>(index) == record.tick;
+        if (producer < PRODUCER_COUNT) {
+            lastSeen[producer] = index;
+        }
+        received++;
+    };
+    while (running.load(std::memory_order_acquire) > 0) {
+        if (ring.Drain(consume, 64) == 0) {
+            std::this_thread::yield();
+        }
+    }
+    while (ring.Drain(consume, 64) > 0) {
+    }
+    for (auto& producer : producers) {
+        producer.join();
+    }
+
+    CHECK(ordered);
+    CHECK(received == PRODUCER_COUNT * PUSHES_PER_PRODUCER);
+    CHECK(ring.TakeDropped() == retries.load());
+    std::printf(
+        "LogRing, %zu producers: %zu received, %llu pushes retried on a full queue\n",
+        PRODUCER_COUNT,
+        received,
+        static_cast<unsigned long long>(retries.load())
+    );
+}
+
+// What Logger::Log did on the calling thread before the queue, without its 1 ms nxlink pause
+void LogSynchronously(std::FILE* sink, const std::string& message) {
+    const auto now = std::chrono::system_clock::now();
+    const std::time_t time = std::chrono::system_clock::to_time_t(now);
+    std::tm localTime;
+    localtime_r(&time, &localTime);
+    std::stringstream ss;
+    ss << std::put_time(&localTime, "[%H:%M:%S] ") << "[DEBUG] " << message;
+    std::fprintf(sink, "%s\n", ss.str().c_str());
+    std::fflush(sink);
+}
+
+struct Percentiles {
+    double p50;
+    double p99;
+    double max;
+};
+
+// Times each call on its own, in nanoseconds
+template <typename Call>
+Percentiles TimeCalls(Call&& call) {
+    std::vector<double> times;
+    times.reserve(LATENCY_CALLS);
+    for (size_t i = 0; i < LATENCY_CALLS; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        call(i);
+        times.push_back(std::chrono::duration<double, std::nano>(std::chrono::steady_clock::now() - start).count());
+        if ((i + 1) % BURST_SIZE == 0) {
+            std::this_thread::sleep_for(BURST_PAUSE);
+        }
+    }
+    std::sort(times.begin(), times.end());
+    return {times[times.size() / 2], times[times.size() * 99 / 100], times.back()};
+}
+
+size_t CountLines(const fs::path& path, const std::string& needle, u64* dropped) {
+    std::ifstream file(path);
+    std::string line;
+    size_t count = 0;
+    while (std::getline(file, line)) {
+        if (line.find(needle) != std::string::npos) {
+            count++;
+        }
+        const size_t droppedPos = line.find("] [WARNING] ");
+        if (dropped && droppedPos != std::string::npos && line.find("log messages dropped") != std::string::npos) {
+            *dropped += std::stoull(line.substr(droppedPos + std::strlen("] [WARNING] ")));
+        }
+    }
+    return count;
+}
+
+void TestLatency(const fs::path& dir) {
+    const fs::path queuedPath = dir / "queued.log";
+    std::FILE* queuedSink = std::fopen(queuedPath.string().c_str(), "w");
+    CHECK(queuedSink != nullptr);
+    if (!queuedSink) {
+        return;
+    }
+
+    Logger::Initialize(queuedSink);
+    CHECK(Logger::IsEnabled(Logger::Level::Debug));
+    const Percentiles queued = TimeCalls([](size_t i) {
+        LOG_DEBUG("Loaded box " + std::to_string(i) + " in " + std::to_string(i % 97) + "ms");
+    });
+    Logger::Finalize();
+    CHECK(!Logger::IsEnabled(Logger::Level::Error));
+    std::fclose(queuedSink);
+
+    // Finalize writes everything that was queued, so each call is either in the file or counted as dropped
+    u64 dropped = 0;
+    const size_t written = CountLines(queuedPath, "[DEBUG] Loaded box ", &dropped);
+    CHECK(written + dropped == LATENCY_CALLS);
+    CHECK(CountLines(queuedPath, "[DEBUG] Loaded box 0 in 0ms", nullptr) == 1);
+
+    const fs::path synchronousPath = dir / "synchronous.log";
+    std::FILE* synchronousSink = std::fopen(synchronousPath.string().c_str(), "w");
+    CHECK(synchronousSink != nullptr);
+    if (!synchronousSink) {
+        return;
+    }
+    const Percentiles synchronous = TimeCalls([synchronousSink](size_t i) {
+        LogSynchronously(synchronousSink, "Loaded box " + std::to_string(i) + " in " + std::to_string(i % 97) + "ms");
+    });
+    std::fclose(synchronousSink);
+
+    const Percentiles timer = TimeCalls([](size_t) {});
+
+    std::printf("Log call latency over %zu calls, to a file:\n", LATENCY_CALLS);
+    std::printf(
+        "  LOG_DEBUG through the queue  p50 %6.0f ns  p99 %6.0f ns  max %8.0f ns  (%llu dropped)\n",
+        queued.p50,
+        queued.p99,
+        queued.max,
+        static_cast<unsigned long long>(dropped)
+    );
+    std::printf(
+        "  formatted and written inline p50 %6.0f ns  p99 %6.0f ns  max %8.0f ns\n",
+        synchronous.p50,
+        synchronous.p99,
+        synchronous.max
+    );
+    std::printf("  timer overhead               p50 %6.0f ns\n", timer.p50);
+}
+
+}  // namespace
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "pksm_logger_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    TestRing();
+    TestProducers();
+    TestLatency(dir);
+
+    fs::remove_all(dir);
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,207 @@
+// Draws a representative screen through Plutonium's renderer with shape batching on and off, on SDL's software
+// renderer, and compares draw calls and frame times. Needs SDL 2.0.18 or later for batching, plus SDL2_gfx,
+// SDL2_image, SDL2_mixer and FreeType. Runs on a PC; from the repository root:
+//
+//   gcc -c -Iinclude -Itests/host `sdl2-config --cflags` `pkg-config --cflags freetype2`
+//       source/pu/sdl2/sdl2_CustomTtf.c -o sdl2_CustomTtf.o
+//   g++ -std=gnu++20 -DNDEBUG -Iinclude -Itests/host `sdl2-config --cflags` -o RendererBatchBenchmark
+//       tests/RendererBatchBenchmark.cpp source/pu/ui/render/render_Renderer.cpp
+//       source/pu/ui/render/render_SDL2.cpp source/pu/ttf/ttf_Font.cpp source/pu/ui/ui_Types.cpp
+//       sdl2_CustomTtf.o `sdl2-config --libs` -lSDL2_gfx -lSDL2_image -lSDL2_mixer -lfreetype
+//   SDL_VIDEODRIVER=dummy ./RendererBatchBenchmark
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <pu/ui/render/render_Renderer.hpp>
+#include <vector>
+
+#include "TestHelpers.hpp"
+
+using pksm::tests::MicrosecondsSince;
+using pu::ui::Color;
+using pu::ui::render::Renderer;
+
+namespace {
+
+constexpr size_t FRAME_COUNT = 300;
+
+// The box screen, built from the same shapes and sizes as PokemonBox and its items
+constexpr pu::i32 ITEMS_PER_ROW = 6;
+constexpr pu::i32 ROW_COUNT = 5;
+constexpr pu::i32 ITEM_SIZE = 96;
+constexpr pu::i32 ITEM_SPACING = 12;
+constexpr pu::i32 ITEM_OUTLINE_WIDTH = 5;
+constexpr pu::i32 FOCUS_OUTLINE_WIDTH = 8;
+
+constexpr Color BACKGROUND_COLOR(30, 30, 50, 255);
+constexpr Color FRAME_COLOR(0, 136, 170, 255);
+constexpr Color BORDER_COLOR(26, 56, 66, 255);
+constexpr Color ITEM_COLOR(255, 255, 255, 40);
+constexpr Color OUTLINE_COLOR(255, 255, 255, 120);
+constexpr Color FOCUS_COLOR(0, 200, 255, 255);
+constexpr Color BUTTON_COLOR(40, 40, 60, 200);
+
+// Returns how many shapes were drawn
+size_t DrawBoxScreen(Renderer::Ref& renderer) {
+    size_t shapes = 0;
+    const pu::i32 frameX = 100;
+    const pu::i32 frameY = 80;
+    const pu::i32 frameWidth = (ITEMS_PER_ROW * (ITEM_SIZE + ITEM_SPACING)) + 20;
+    const pu::i32 frameHeight = (ROW_COUNT * (ITEM_SIZE + ITEM_SPACING)) + 200;
+
+    // Frame with its border, as PokemonBox draws it
+    renderer->RenderRoundedRectangleFill(BORDER_COLOR, frameX - 2, frameY - 2, frameWidth + 4, frameHeight + 4, 22);
+    renderer->RenderRoundedRectangleFill(FRAME_COLOR, frameX, frameY, frameWidth, frameHeight, 20);
+    shapes += 2;
+
+    // Box name pill, the two box navigation buttons and the box spaces button
+    renderer->RenderRoundedRectangleFill(BUTTON_COLOR, frameX + 150, frameY + 30, 400, 60, 30);
+    renderer->RenderRoundedRectangleFill(BUTTON_COLOR, frameX + 25, frameY + 30, 60, 60, 30);
+    renderer->RenderRoundedRectangleFill(BUTTON_COLOR, frameX + frameWidth - 85, frameY + 30, 60, 60, 30);
+    renderer->RenderRoundedRectangleFill(BUTTON_COLOR, frameX + 200, frameY + frameHeight - 75, 300, 60, 30);
+    shapes += 4;
+
+    // Every slot has a background and a static outline. One slot is focused and has the pulsing outline instead.
+    for (pu::i32 row = 0; row < ROW_COUNT; row++) {
+        for (pu::i32 column = 0; column < ITEMS_PER_ROW; column++) {
+            const pu::i32 x = frameX + 10 + (column * (ITEM_SIZE + ITEM_SPACING));
+            const pu::i32 y = frameY + 110 + (row * (ITEM_SIZE + ITEM_SPACING));
+            renderer->RenderRoundedRectangleFill(ITEM_COLOR, x, y, ITEM_SIZE, ITEM_SIZE, 12);
+            if ((row == 2) && (column == 3)) {
+                renderer->RenderRoundedRectangleBorder(
+                    FOCUS_COLOR,
+                    x - 6,
+                    y - 6,
+                    ITEM_SIZE + 12,
+                    ITEM_SIZE + 12,
+                    16,
+                    FOCUS_OUTLINE_WIDTH
+                );
+            } else {
+                renderer->RenderRoundedRectangleBorder(
+                    OUTLINE_COLOR,
+                    x - 3,
+                    y - 3,
+                    ITEM_SIZE + 6,
+                    ITEM_SIZE + 6,
+                    14,
+                    ITEM_OUTLINE_WIDTH
+                );
+            }
+            shapes += 2;
+        }
+    }
+
+    // Side panel and help footer
+    renderer->RenderRoundedRectangleFill(BUTTON_COLOR, 900, 80, 320, 560, 16);
+    renderer->RenderRectangleFill(BUTTON_COLOR, 0, 670, 1280, 50);
+    renderer->RenderRectangle(OUTLINE_COLOR, 900, 80, 320, 560);
+    shapes += 3;
+    return shapes;
+}
+
+struct FrameStats {
+    size_t shapes = 0;
+    double firstFrame = 0;  // Includes tessellating each shape size once when batching
+    double averageFrame = 0;
+    u32 drawCalls = 0;
+};
+
+FrameStats DrawFrames(Renderer::Ref& renderer, const bool batching) {
+    renderer->SetShapeBatching(batching);
+    FrameStats stats;
+    double total = 0;
+    for (size_t i = 0; i < FRAME_COUNT; i++) {
+        const auto start = std::chrono::steady_clock::now();
+        renderer->InitializeRender(BACKGROUND_COLOR);
+        stats.shapes = DrawBoxScreen(renderer);
+        renderer->FinalizeRender();
+        const double elapsed = MicrosecondsSince(start);
+        if (i == 0) {
+            stats.firstFrame = elapsed;
+        } else {
+            total += elapsed;
+        }
+    }
+    stats.averageFrame = total / (FRAME_COUNT - 1);
+    stats.drawCalls = renderer->GetLastFrameDrawCallCount();
+    return stats;
+}
+
+std::vector<u32> ReadPixels() {
+    const auto [width, height] = pu::ui::render::GetDimensions();
+    std::vector<u32> pixels(static_cast<size_t>(width) * height);
+    SDL_RenderReadPixels(
+        pu::ui::render::GetMainRenderer(),
+        nullptr,
+        SDL_PIXELFORMAT_ARGB8888,
+        pixels.data(),
+        static_cast<int>(width * sizeof(u32))
+    );
+    return pixels;
+}
+
+// Fraction of pixels that differ between the batched and unbatched drawing of the screen
+double DifferingPixels(Renderer::Ref& renderer) {
+    std::vector<u32> frames[2];
+    for (const bool batching : {false, true}) {
+        renderer->SetShapeBatching(batching);
+        renderer->InitializeRender(BACKGROUND_COLOR);
+        DrawBoxScreen(renderer);
+        renderer->FlushShapes();
+        frames[batching ? 1 : 0] = ReadPixels();
+        renderer->FinalizeRender();
+    }
+
+    size_t differing = 0;
+    for (size_t i = 0; i < frames[0].size(); i++) {
+        if (frames[0][i] != frames[1][i]) {
+            differing++;
+        }
+    }
+    return static_cast<double>(differing) / frames[0].size();
+}
+
+}  // namespace
+
+int main() {
+    auto renderer =
+        Renderer::New(pu::ui::render::RendererInitOptions(SDL_INIT_VIDEO, SDL_RENDERER_SOFTWARE, 1280, 720));
+    renderer->Initialize();
+    if (pu::ui::render::GetMainRenderer() == nullptr) {
+        std::printf("Failed to create an SDL renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    // Unbatched first, so the batched run starts with no shapes tessellated
+    const FrameStats unbatched = DrawFrames(renderer, false);
+    const FrameStats batched = DrawFrames(renderer, true);
+    const double differing = DifferingPixels(renderer);
+
+    // Unbatched, every shape is a call of its own and a border is one rounded rectangle per pixel of width
+    CHECK(unbatched.drawCalls > unbatched.shapes);
+#if SDL_VERSION_ATLEAST(2, 0, 18)
+    // Nothing but shapes is drawn, so the whole screen is one SDL_RenderGeometry call
+    CHECK(batched.drawCalls == 1);
+#endif
+
+    std::printf("Box screen, %zu shapes, %zu frames on the software renderer:\n", batched.shapes, FRAME_COUNT);
+    std::printf(
+        "  unbatched  %4u draw calls, first frame %8.0f us, average %8.0f us\n",
+        unbatched.drawCalls,
+        unbatched.firstFrame,
+        unbatched.averageFrame
+    );
+    std::printf(
+        "  batched    %4u draw calls, first frame %8.0f us, average %8.0f us\n",
+        batched.drawCalls,
+        batched.firstFrame,
+        batched.averageFrame
+    );
+    std::printf("  pixels differing between the two: %.3f%%\n", differing * 100.0);
+
+    renderer->Finalize();
+    return pksm::tests::Finish();
+}
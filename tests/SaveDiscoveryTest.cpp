@@ -0,0 +1,140 @@
+// Checks that SaveDiscovery mounts each console save once and times discovery over many titles,
+// with saves kept as plain directories. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -DNDEBUG -Iinclude -Iinclude/pksmcore -Itests/host -o SaveDiscoveryTest
+//       tests/SaveDiscoveryTest.cpp source/data/saves/SaveDiscovery.cpp
+//   ./SaveDiscoveryTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <memory>
+#include <string>
+
+#include "data/providers/mock/DirectorySaveMounter.hpp"
+#include "data/saves/SaveDiscovery.hpp"
+#include "TestHelpers.hpp"
+
+using pksm::saves::SaveDiscovery;
+using pksm::tests::MicrosecondsSince;
+namespace fs = std::filesystem;
+
+namespace {
+
+// Roughly a well used console
+constexpr size_t TITLE_COUNT = 200;
+constexpr u64 FIRST_TITLE_ID = 0x0100000000010000;
+constexpr AccountUid USER_ID = {{1, 2}};
+constexpr AccountUid OTHER_USER_ID = {{3, 4}};
+
+u64 TitleId(size_t index) {
+    return FIRST_TITLE_ID + (static_cast<u64>(index) << 16);
+}
+
+// A save with a main file and, for every other title, a second file in a subdirectory
+void CreateSaves(const fs::path& root) {
+    for (size_t i = 0; i < TITLE_COUNT; i++) {
+        char dir[64];
+        std::snprintf(
+            dir,
+            sizeof(dir),
+            "%016llx/%016llx%016llx",
+            static_cast<unsigned long long>(TitleId(i)),
+            static_cast<unsigned long long>(USER_ID.uid[0]),
+            static_cast<unsigned long long>(USER_ID.uid[1])
+        );
+        const fs::path saveDir = root / dir;
+        fs::create_directories(saveDir / "backup");
+        std::ofstream(saveDir / "main", std::ios::binary) << std::string(4096, 'x');
+        if (i % 2 == 0) {
+            std::ofstream(saveDir / "backup" / "main", std::ios::binary) << std::string(1024, 'y');
+        }
+    }
+}
+
+// Look up every title once, returning the time taken in microseconds
+double DiscoverAll(SaveDiscovery& discovery, size_t& found) {
+    found = 0;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < TITLE_COUNT; i++) {
+        found += discovery.Discover(TitleId(i), USER_ID).exists ? 1 : 0;
+    }
+    return MicrosecondsSince(start);
+}
+
+void TestIndex(const fs::path& root) {
+    auto mounter = std::make_shared<DirectorySaveMounter>(root.string());
+    SaveDiscovery discovery(mounter);
+
+    const auto entry = discovery.Discover(TitleId(0), USER_ID);
+    CHECK(entry.exists);
+    CHECK(entry.Find("main") != nullptr);
+    CHECK(entry.Find("main") && entry.Find("main")->size == 4096);
+    CHECK(entry.Find("backup/main") != nullptr);
+    CHECK(entry.Find("missing") == nullptr);
+    CHECK(entry.root.back() == '/');
+    CHECK(discovery.Discover(TitleId(1), USER_ID).Find("backup/main") == nullptr);
+
+    // A user without a save is remembered as such, and isn't mounted again either
+    CHECK(!discovery.Discover(TitleId(0), OTHER_USER_ID).exists);
+    const size_t mounts = mounter->GetMountCount();
+    CHECK(!discovery.Discover(TitleId(0), OTHER_USER_ID).exists);
+    CHECK(mounter->GetMountCount() == mounts);
+
+    // Forgetting one save remounts only that one
+    discovery.Invalidate(TitleId(0), USER_ID);
+    CHECK(discovery.Discover(TitleId(0), USER_ID).exists);
+    CHECK(discovery.Discover(TitleId(1), USER_ID).exists);
+    CHECK(mounter->GetMountCount() == mounts + 1);
+}
+
+// Mount counts over whole refreshes, and how long each kind of refresh takes
+void TestRefreshes(const fs::path& root) {
+    auto mounter = std::make_shared<DirectorySaveMounter>(root.string());
+    SaveDiscovery discovery(mounter);
+    size_t found = 0;
+
+    const double first = DiscoverAll(discovery, found);
+    CHECK(found == TITLE_COUNT);
+    CHECK(mounter->GetMountCount() == TITLE_COUNT);
+
+    const double repeat = DiscoverAll(discovery, found);
+    CHECK(found == TITLE_COUNT);
+    CHECK(mounter->GetMountCount() == TITLE_COUNT);
+
+    discovery.Invalidate();
+    const double afterInvalidate = DiscoverAll(discovery, found);
+    CHECK(found == TITLE_COUNT);
+    CHECK(mounter->GetMountCount() == 2 * TITLE_COUNT);
+
+    // What every lookup cost before the index, when each one mounted and listed the save again
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < TITLE_COUNT; i++) {
+        discovery.Invalidate(TitleId(i), USER_ID);
+        discovery.Discover(TitleId(i), USER_ID);
+    }
+    const double uncached = MicrosecondsSince(start);
+
+    std::printf("Discovery over %zu titles:\n", TITLE_COUNT);
+    std::printf("  first refresh      %9.0f us (%.1f us per title)\n", first, first / TITLE_COUNT);
+    std::printf("  repeat query       %9.0f us (%.2f us per title)\n", repeat, repeat / TITLE_COUNT);
+    std::printf("  after Invalidate   %9.0f us\n", afterInvalidate);
+    std::printf("  mount every lookup %9.0f us\n", uncached);
+}
+
+}  // namespace
+
+int main() {
+    const fs::path root = fs::temp_directory_path() / "pksm_save_discovery_test";
+    fs::remove_all(root);
+    CreateSaves(root);
+
+    TestIndex(root);
+    TestRefreshes(root);
+
+    fs::remove_all(root);
+    return pksm::tests::Finish();
+}
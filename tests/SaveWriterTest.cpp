@@ -0,0 +1,169 @@
+// Checks SaveWriter against saves kept as plain directories and times writes of each Switch save
+// size. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -DNDEBUG -Iinclude -Iinclude/pksmcore -Itests/host -o SaveWriterTest
+//       tests/SaveWriterTest.cpp source/data/saves/SaveWriter.cpp source/utils/ZipReader.cpp -lz
+//   ./SaveWriterTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <memory>
+#include <string>
+#include <vector>
+
+#include "data/providers/mock/DirectorySaveMounter.hpp"
+#include "data/saves/SaveWriter.hpp"
+#include "TestHelpers.hpp"
+
+using pksm::saves::SaveWriter;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr u64 TITLE_ID = 0x0100ABF008968000;
+constexpr AccountUid USER_ID = {{1, 2}};
+
+std::vector<u8> ReadAll(const fs::path& path) {
+    std::ifstream file(path, std::ios::binary);
+    return {std::istreambuf_iterator<char>(file), std::istreambuf_iterator<char>()};
+}
+
+void WriteAll(const fs::path& path, const std::vector<u8>& data) {
+    std::ofstream file(path, std::ios::binary);
+    file.write(reinterpret_cast<const char*>(data.data()), static_cast<std::streamsize>(data.size()));
+}
+
+size_t CountFiles(const fs::path& root) {
+    size_t count = 0;
+    std::error_code ec;
+    for (const auto& entry : fs::recursive_directory_iterator(root, ec)) {
+        count += entry.is_regular_file() ? 1 : 0;
+    }
+    return count;
+}
+
+void TestSavePaths() {
+    CHECK(SaveWriter::ResolveSavePath("main") == "save:/main");
+    CHECK(SaveWriter::ResolveSavePath("save:/main") == "save:/main");
+    CHECK(SaveWriter::ResolveSavePath("sdmc:/saves/main") == "sdmc:/saves/main");
+    CHECK(SaveWriter::IsSaveDevicePath(SaveWriter::ResolveSavePath("main")));
+    CHECK(!SaveWriter::IsSaveDevicePath("sdmc:/saves/main"));
+}
+
+// Writes into a mounted save overwrite the file in place and commit once each
+void TestMountedSave(const fs::path& dir) {
+    auto mounter = std::make_shared<DirectorySaveMounter>((dir / "saves").string());
+    fs::create_directories(dir / "saves" / "0100abf008968000" / "00000000000000010000000000000002");
+    const auto root = mounter->Mount(TITLE_ID, USER_ID);
+    CHECK(root.has_value());
+    if (!root) {
+        return;
+    }
+
+    SaveWriter writer(mounter, (dir / "backups").string());
+    const std::string path = *root + "main";
+    const std::vector<u8> first(1000, 1);
+    const std::vector<u8> second(600, 2);
+
+    CHECK(writer.WriteData(first.data(), first.size(), TITLE_ID, path, SaveWriter::Destination::MountedSave));
+    CHECK(mounter->GetCommitCount() == 1);
+    CHECK(ReadAll(path) == first);
+    CHECK(CountFiles(dir / "backups") == 0);
+
+    CHECK(writer.WriteData(second.data(), second.size(), TITLE_ID, path, SaveWriter::Destination::MountedSave));
+    CHECK(mounter->GetCommitCount() == 2);
+    CHECK(ReadAll(path) == second);
+    CHECK(!fs::exists(path + SaveWriter::TEMP_SUFFIX));
+    CHECK(CountFiles(dir / "backups") == 1);
+
+    // The writer uses the save as mounted and never mounts it again
+    CHECK(mounter->GetMountCount() == 1);
+
+    // Saves inside zipped backups are rejected before anything is written or committed
+    const std::string zipPath = (dir / "backup.zip#main").string();
+    CHECK(!writer.WriteData(first.data(), first.size(), TITLE_ID, zipPath, SaveWriter::Destination::SdCard));
+    CHECK(mounter->GetCommitCount() == 2);
+}
+
+// Files on the SD card are replaced through a temporary file, and an interrupted swap is recovered
+void TestSdCardSave(const fs::path& dir) {
+    auto mounter = std::make_shared<DirectorySaveMounter>((dir / "saves").string());
+    SaveWriter writer(mounter, "");
+    const std::string path = (dir / "main").string();
+    const std::vector<u8> first(1000, 1);
+    const std::vector<u8> second(2000, 2);
+
+    CHECK(writer.WriteData(first.data(), first.size(), TITLE_ID, path, SaveWriter::Destination::SdCard));
+    CHECK(writer.WriteData(second.data(), second.size(), TITLE_ID, path, SaveWriter::Destination::SdCard));
+    CHECK(ReadAll(path) == second);
+    CHECK(!fs::exists(path + SaveWriter::TEMP_SUFFIX));
+    CHECK(!fs::exists(path + SaveWriter::PREVIOUS_SUFFIX));
+    CHECK(mounter->GetCommitCount() == 0);
+
+    // Cut short after moving the original aside: the complete new file wins
+    fs::rename(path, path + SaveWriter::PREVIOUS_SUFFIX);
+    WriteAll(path + SaveWriter::TEMP_SUFFIX, first);
+    CHECK(SaveWriter::RecoverInterruptedWrite(path));
+    CHECK(ReadAll(path) == first);
+
+    // Cut short before removing the previous file: the next write still succeeds
+    WriteAll(path + SaveWriter::PREVIOUS_SUFFIX, second);
+    CHECK(writer.WriteData(second.data(), second.size(), TITLE_ID, path, SaveWriter::Destination::SdCard));
+    CHECK(ReadAll(path) == second);
+    CHECK(!fs::exists(path + SaveWriter::PREVIOUS_SUFFIX));
+
+    CHECK(!SaveWriter::RecoverInterruptedWrite((dir / "missing").string()));
+}
+
+// Average write time of each Switch save size, without backups
+void BenchmarkSaveSizes(const fs::path& dir) {
+    auto mounter = std::make_shared<DirectorySaveMounter>((dir / "saves").string());
+    SaveWriter writer(mounter, "");
+    const struct {
+        const char* game;
+        size_t size;
+    } saves[] = {{"LGPE", 0x100000}, {"SWSH", 0x171500}, {"BDSP", 0xE9828}, {"LA", 0x136DDE}, {"SV", 0x31626F}};
+    constexpr int ROUNDS = 20;
+
+    for (const auto& save : saves) {
+        const std::vector<u8> data(save.size, 7);
+        for (const auto destination : {SaveWriter::Destination::MountedSave, SaveWriter::Destination::SdCard}) {
+            long long total = 0;
+            for (int i = 0; i < ROUNDS; i++) {
+                SaveWriter::Timing timing;
+                const std::string path = (dir / save.game).string();
+                CHECK(writer.WriteData(data.data(), data.size(), TITLE_ID, path, destination, &timing));
+                total += timing.total.count();
+            }
+            std::printf(
+                "%-5s %8zu bytes, %-12s %6lld us\n",
+                save.game,
+                save.size,
+                (destination == SaveWriter::Destination::MountedSave) ? "in place" : "temp+rename",
+                total / ROUNDS
+            );
+        }
+    }
+}
+
+}  // namespace
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "pksm_save_writer_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    TestSavePaths();
+    TestMountedSave(dir / "mounted");
+    TestSdCardSave(dir);
+    fs::create_directories(dir / "benchmark");
+    BenchmarkSaveSizes(dir / "benchmark");
+
+    fs::remove_all(dir);
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+// Checks and timing shared by the host test programs in this directory
+
+#include <chrono>
+#include <cstdio>
+
+namespace pksm::tests {
+
+inline int failures = 0;
+
+// Microseconds since start, as a double so short runs keep their fraction
+inline double MicrosecondsSince(std::chrono::steady_clock::time_point start) {
+    return std::chrono::duration<double, std::micro>(std::chrono::steady_clock::now() - start).count();
+}
+
+// Report the checks and turn them into the program's exit code
+inline int Finish() {
+    std::printf(failures ? "%d checks failed\n" : "All checks passed\n", failures);
+    return failures ? 1 : 0;
+}
+
+}  // namespace pksm::tests
+
+// Record a failed condition and keep going, so one run reports every failure
+#define CHECK(condition)                                                              \
+    do {                                                                              \
+        if (!(condition)) {                                                           \
+            std::printf("%s:%d: check failed: %s\n", __FILE__, __LINE__, #condition); \
+            pksm::tests::failures++;                                                  \
+        }                                                                             \
+    } while (0)
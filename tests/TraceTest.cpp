@@ -0,0 +1,174 @@
+// Checks that TRACE_SCOPE spans from several threads export as a valid Chrome trace and measures
+// what one span costs, both recorded and dropped from a full buffer. Runs on a PC; from the
+// repository root:
+//
+//   g++ -std=gnu++20 -O2 -DNDEBUG -DPKSM_TRACE -Iinclude -Itests/host -o TraceTest tests/TraceTest.cpp
+//       source/utils/Trace.cpp -pthread
+//   ./TraceTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <map>
+#include <nlohmann/json.hpp>
+#include <string>
+#include <thread>
+#include <vector>
+
+#include "TestHelpers.hpp"
+#include "utils/Trace.hpp"
+
+#ifndef PKSM_TRACE
+#error "Build with -DPKSM_TRACE, otherwise TRACE_SCOPE records nothing"
+#endif
+
+using pksm::tests::MicrosecondsSince;
+using pksm::utils::Tracer;
+namespace fs = std::filesystem;
+
+namespace {
+
+constexpr size_t BENCHMARK_THREADS = 40;
+constexpr size_t DROPPED_SPANS = 1000000;
+
+// Keeps the compiler from dropping the clock reads
+u64 sink = 0;
+
+// Returns the trace's events, or an empty array if it didn't parse
+nlohmann::json ReadTrace(const fs::path& path) {
+    std::ifstream file(path);
+    try {
+        return nlohmann::json::parse(file).at("traceEvents");
+    } catch (const nlohmann::json::exception& e) {
+        std::printf("Invalid trace %s: %s\n", path.string().c_str(), e.what());
+        return nlohmann::json::array();
+    }
+}
+
+void TestExport(const fs::path& dir) {
+    {
+        TRACE_SCOPE("outer");
+        TRACE_SCOPE("inner \"quoted\"");
+    }
+    std::thread worker([]() {
+        for (int i = 0; i < 3; i++) {
+            TRACE_SCOPE("worker");
+        }
+    });
+    worker.join();
+
+    const fs::path path = dir / "trace.json";
+    CHECK(Tracer::WriteChromeTrace(path.string()));
+    const nlohmann::json events = ReadTrace(path);
+    CHECK(events.size() == 5);
+
+    std::map<std::string, std::vector<nlohmann::json>> byName;
+    for (const auto& event : events) {
+        CHECK(event.at("ph") == "X");
+        CHECK(event.at("dur").get<double>() >= 0);
+        byName[event.at("name").get<std::string>()].push_back(event);
+    }
+    CHECK(byName["outer"].size() == 1 && byName["inner \"quoted\""].size() == 1 && byName["worker"].size() == 3);
+    if (byName["outer"].size() == 1 && byName["inner \"quoted\""].size() == 1 && !byName["worker"].empty()) {
+        const auto& outer = byName["outer"].front();
+        const auto& inner = byName["inner \"quoted\""].front();
+        const double outerEnd = outer.at("ts").get<double>() + outer.at("dur").get<double>();
+        const double innerEnd = inner.at("ts").get<double>() + inner.at("dur").get<double>();
+        CHECK(inner.at("ts").get<double>() >= outer.at("ts").get<double>() && innerEnd <= outerEnd);
+        CHECK(inner.at("tid") == outer.at("tid"));
+        CHECK(byName["worker"].front().at("tid") != outer.at("tid"));
+    }
+}
+
+// Nanoseconds per span. Each thread fills exactly its own buffer, so every span is kept.
+double TimeRecordedSpans() {
+    std::vector<double> perThread(BENCHMARK_THREADS);
+    for (size_t t = 0; t < BENCHMARK_THREADS; t++) {
+        std::thread thread([&perThread, t]() {
+            // The first span registers the thread's buffer, which is a one-off cost
+            const auto start = std::chrono::steady_clock::now();
+            for (size_t i = 0; i < Tracer::EVENTS_PER_THREAD; i++) {
+                TRACE_SCOPE("span");
+            }
+            perThread[t] = MicrosecondsSince(start);
+        });
+        thread.join();
+    }
+
+    double total = 0;
+    for (const double time : perThread) {
+        total += time;
+    }
+    return total * 1000.0 / (BENCHMARK_THREADS * Tracer::EVENTS_PER_THREAD);
+}
+
+// Nanoseconds per span once the calling thread's buffer is full, and for the span's two clock reads alone
+void TimeDroppedSpans(double& perSpan, double& clockReads) {
+    std::thread thread([&perSpan, &clockReads]() {
+        for (size_t i = 0; i < Tracer::EVENTS_PER_THREAD; i++) {
+            TRACE_SCOPE("filler");
+        }
+
+        auto start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < DROPPED_SPANS; i++) {
+            TRACE_SCOPE("dropped");
+        }
+        perSpan = MicrosecondsSince(start) * 1000.0 / DROPPED_SPANS;
+
+        start = std::chrono::steady_clock::now();
+        for (size_t i = 0; i < DROPPED_SPANS; i++) {
+            sink += Tracer::Now() - Tracer::Now();
+        }
+        clockReads = MicrosecondsSince(start) * 1000.0 / DROPPED_SPANS;
+    });
+    thread.join();
+}
+
+void TestSpanCost(const fs::path& dir) {
+    const double recorded = TimeRecordedSpans();
+    double dropped = 0;
+    double clockReads = 0;
+    TimeDroppedSpans(dropped, clockReads);
+
+    // Everything recorded so far is exported, and none of the spans past a full buffer
+    const fs::path path = dir / "benchmark.json";
+    const auto start = std::chrono::steady_clock::now();
+    CHECK(Tracer::WriteChromeTrace(path.string()));
+    const double exportTime = MicrosecondsSince(start);
+    const size_t expected = 5 + ((BENCHMARK_THREADS + 1) * Tracer::EVENTS_PER_THREAD);
+    const nlohmann::json events = ReadTrace(path);
+    CHECK(events.size() == expected);
+
+    std::printf("Trace spans:\n");
+    std::printf(
+        "  recorded span          %6.1f ns (%zu threads x %zu spans)\n",
+        recorded,
+        BENCHMARK_THREADS,
+        Tracer::EVENTS_PER_THREAD
+    );
+    std::printf("  span past a full buffer %5.1f ns\n", dropped);
+    std::printf("  two clock reads        %6.1f ns\n", clockReads);
+    std::printf(
+        "  export of %zu spans   %6.0f ms (%.1f MiB)\n",
+        expected,
+        exportTime / 1000.0,
+        fs::file_size(path) / (1024.0 * 1024.0)
+    );
+}
+
+}  // namespace
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "pksm_trace_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    TestExport(dir);
+    TestSpanCost(dir);
+
+    fs::remove_all(dir);
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,241 @@
+// Checks that ZipReader extracts stored and deflated entries and rejects damaged ones, and measures
+// inflate throughput on a save-sized and a large entry. Runs on a PC; from the repository root:
+//
+//   g++ -std=gnu++20 -O2 -DNDEBUG -Iinclude -Iinclude/pksmcore -Itests/host -o ZipReaderTest
+//       tests/ZipReaderTest.cpp source/utils/ZipReader.cpp -lz
+//   ./ZipReaderTest
+//
+// tests/host stands in for the libnx headers.
+
+#include <chrono>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <string>
+#include <vector>
+#include <zlib.h>
+
+#include "TestHelpers.hpp"
+#include "utils/ZipReader.hpp"
+
+using pksm::tests::MicrosecondsSince;
+using pksm::utils::ZipReader;
+namespace fs = std::filesystem;
+
+namespace {
+
+// About the size of a Scarlet/Violet save, and one big enough to time the inflate loop alone
+constexpr size_t SAVE_SIZE = 2 * 1024 * 1024;
+constexpr size_t LARGE_SIZE = 32 * 1024 * 1024;
+constexpr size_t SAVE_EXTRACTIONS = 20;
+
+struct ZipFile {
+    std::string name;
+    std::vector<u8> data;
+    u16 method;
+};
+
+void Put16(std::vector<u8>& out, u16 value) {
+    out.push_back(static_cast<u8>(value));
+    out.push_back(static_cast<u8>(value >> 8));
+}
+
+void Put32(std::vector<u8>& out, u32 value) {
+    Put16(out, static_cast<u16>(value));
+    Put16(out, static_cast<u16>(value >> 16));
+}
+
+std::vector<u8> Deflate(const std::vector<u8>& data) {
+    z_stream stream{};
+    deflateInit2(&stream, Z_DEFAULT_COMPRESSION, Z_DEFLATED, -MAX_WBITS, 8, Z_DEFAULT_STRATEGY);
+    std::vector<u8> out(deflateBound(&stream, data.size()));
+    stream.next_in = const_cast<u8*>(data.data());
+    stream.avail_in = static_cast<uInt>(data.size());
+    stream.next_out = out.data();
+    stream.avail_out = static_cast<uInt>(out.size());
+    deflate(&stream, Z_FINISH);
+    out.resize(stream.total_out);
+    deflateEnd(&stream);
+    return out;
+}
+
+// A minimal archive: local headers and data, then the central directory
+void WriteZip(const fs::path& path, const std::vector<ZipFile>& files) {
+    std::vector<u8> archive;
+    std::vector<u8> central;
+    for (const auto& file : files) {
+        const std::vector<u8> body = (file.method == ZipReader::METHOD_DEFLATED) ? Deflate(file.data) : file.data;
+        const u32 crc = static_cast<u32>(crc32_z(0, file.data.data(), file.data.size()));
+        const u32 offset = static_cast<u32>(archive.size());
+
+        Put32(archive, 0x04034b50);
+        Put16(archive, 20);
+        Put16(archive, 0);
+        Put16(archive, file.method);
+        Put32(archive, 0);
+        Put32(archive, crc);
+        Put32(archive, static_cast<u32>(body.size()));
+        Put32(archive, static_cast<u32>(file.data.size()));
+        Put16(archive, static_cast<u16>(file.name.size()));
+        Put16(archive, 0);
+        archive.insert(archive.end(), file.name.begin(), file.name.end());
+        archive.insert(archive.end(), body.begin(), body.end());
+
+        Put32(central, 0x02014b50);
+        Put16(central, 20);
+        Put16(central, 20);
+        Put16(central, 0);
+        Put16(central, file.method);
+        Put32(central, 0);
+        Put32(central, crc);
+        Put32(central, static_cast<u32>(body.size()));
+        Put32(central, static_cast<u32>(file.data.size()));
+        Put16(central, static_cast<u16>(file.name.size()));
+        Put16(central, 0);
+        Put16(central, 0);
+        Put16(central, 0);
+        Put16(central, 0);
+        Put32(central, 0);
+        Put32(central, offset);
+        central.insert(central.end(), file.name.begin(), file.name.end());
+    }
+
+    const u32 centralOffset = static_cast<u32>(archive.size());
+    archive.insert(archive.end(), central.begin(), central.end());
+    Put32(archive, 0x06054b50);
+    Put16(archive, 0);
+    Put16(archive, 0);
+    Put16(archive, static_cast<u16>(files.size()));
+    Put16(archive, static_cast<u16>(files.size()));
+    Put32(archive, static_cast<u32>(central.size()));
+    Put32(archive, centralOffset);
+    Put16(archive, 0);
+
+    std::ofstream(path, std::ios::binary).write(reinterpret_cast<const char*>(archive.data()), archive.size());
+}
+
+// Compresses to about a third, like a real save: repeated structures with varying fields and runs of padding
+std::vector<u8> MakeSaveData(size_t size) {
+    std::vector<u8> data(size);
+    u32 state = 12345;
+    for (size_t i = 0; i < size; i++) {
+        if ((i % 512) >= 384) {
+            data[i] = 0;
+        } else if ((i % 4) == 0) {
+            state = (state * 1103515245) + 12345;
+            data[i] = static_cast<u8>(state >> 16);
+        } else {
+            data[i] = static_cast<u8>(i % 64);
+        }
+    }
+    return data;
+}
+
+void TestExtract(const fs::path& dir) {
+    const std::vector<u8> data = MakeSaveData(64 * 1024);
+    const fs::path zipPath = dir / "backup.zip";
+    WriteZip(
+        zipPath,
+        {{"main", data, ZipReader::METHOD_DEFLATED},
+         {"stored/main", data, ZipReader::METHOD_STORED},
+         {"empty", {}, ZipReader::METHOD_DEFLATED}}
+    );
+
+    ZipReader reader;
+    CHECK(reader.Open(zipPath.string()));
+    CHECK(reader.GetEntries().size() == 3);
+    CHECK(reader.Find("missing") == nullptr);
+
+    for (const char* name : {"main", "stored/main"}) {
+        const ZipReader::Entry* entry = reader.Find(name);
+        CHECK(entry != nullptr);
+        if (entry) {
+            std::vector<u8> out(entry->uncompressedSize);
+            CHECK(reader.Extract(*entry, out.data()));
+            CHECK(out == data);
+        }
+    }
+
+    // A wrong checksum is caught even when the data inflates cleanly
+    ZipReader::Entry damaged = *reader.Find("main");
+    damaged.crc32 ^= 1;
+    std::vector<u8> out(damaged.uncompressedSize);
+    CHECK(!reader.Extract(damaged, out.data()));
+
+    CHECK(!reader.Open((dir / "missing.zip").string()));
+    std::ofstream(dir / "not_a.zip") << "not a zip file";
+    CHECK(!reader.Open((dir / "not_a.zip").string()));
+
+    std::string archive;
+    std::string entryName;
+    CHECK(ZipReader::SplitEntryPath(ZipReader::MakeEntryPath(zipPath.string(), "main"), archive, entryName));
+    CHECK(archive == zipPath.string() && entryName == "main");
+    CHECK(!ZipReader::SplitEntryPath((dir / "main").string(), archive, entryName));
+}
+
+// Returns MB/s over the uncompressed size
+double ExtractThroughput(ZipReader& reader, const std::string& name, size_t repeats, const std::vector<u8>& expected) {
+    const ZipReader::Entry* entry = reader.Find(name);
+    CHECK(entry != nullptr);
+    if (!entry) {
+        return 0;
+    }
+
+    std::vector<u8> out(entry->uncompressedSize);
+    bool ok = true;
+    const auto start = std::chrono::steady_clock::now();
+    for (size_t i = 0; i < repeats; i++) {
+        ok = reader.Extract(*entry, out.data()) && ok;
+    }
+    const double elapsed = MicrosecondsSince(start);
+    CHECK(ok && out == expected);
+    return (static_cast<double>(entry->uncompressedSize) * repeats) / elapsed;
+}
+
+void TestThroughput(const fs::path& dir) {
+    const std::vector<u8> save = MakeSaveData(SAVE_SIZE);
+    const std::vector<u8> large = MakeSaveData(LARGE_SIZE);
+    const fs::path zipPath = dir / "large.zip";
+    WriteZip(
+        zipPath,
+        {{"main", save, ZipReader::METHOD_DEFLATED},
+         {"large", large, ZipReader::METHOD_DEFLATED},
+         {"large_stored", large, ZipReader::METHOD_STORED}}
+    );
+
+    ZipReader reader;
+    const auto openStart = std::chrono::steady_clock::now();
+    CHECK(reader.Open(zipPath.string()));
+    const double open = MicrosecondsSince(openStart);
+
+    const double saveRate = ExtractThroughput(reader, "main", SAVE_EXTRACTIONS, save);
+    const double largeRate = ExtractThroughput(reader, "large", 1, large);
+    const double storedRate = ExtractThroughput(reader, "large_stored", 1, large);
+    const auto* entry = reader.Find("large");
+    const double ratio = entry ? static_cast<double>(entry->compressedSize) / entry->uncompressedSize : 0;
+
+    std::printf("ZipReader (archive %.1f MiB):\n", fs::file_size(zipPath) / (1024.0 * 1024.0));
+    std::printf("  open (central directory) %8.0f us\n", open);
+    std::printf("  inflate %2zu MiB save      %8.0f MB/s\n", SAVE_SIZE >> 20, saveRate);
+    std::printf(
+        "  inflate %2zu MiB entry     %8.0f MB/s (compressed to %.0f%%)\n",
+        LARGE_SIZE >> 20,
+        largeRate,
+        ratio * 100
+    );
+    std::printf("  read %2zu MiB stored entry %8.0f MB/s\n", LARGE_SIZE >> 20, storedRate);
+}
+
+}  // namespace
+
+int main() {
+    const fs::path dir = fs::temp_directory_path() / "pksm_zip_reader_test";
+    fs::remove_all(dir);
+    fs::create_directories(dir);
+
+    TestExtract(dir);
+    TestThroughput(dir);
+
+    fs::remove_all(dir);
+    return pksm::tests::Finish();
+}
@@ -0,0 +1,93 @@
+#pragma once
+
+// The parts of libnx the code under test uses, for building tests on a PC
+#include <switch/types.h>
+
+typedef struct {
+    u64 uid[2];
+} AccountUid;
+
+// What Plutonium's renderer needs. There's no romfs, shared font or controller on a PC, so these do nothing.
+#define BIT(n) (1U << (n))
+#define BITL(n) (1ULL << (n))
+#define R_SUCCEEDED(res) ((res) == 0)
+#define R_FAILED(res) ((res) != 0)
+
+typedef enum {
+    PlSharedFontType_Standard = 0,
+    PlSharedFontType_ChineseSimplified = 1,
+    PlSharedFontType_ExtChineseSimplified = 2,
+    PlSharedFontType_ChineseTraditional = 3,
+    PlSharedFontType_KO = 4,
+    PlSharedFontType_NintendoExt = 5,
+    PlSharedFontType_Total,
+} PlSharedFontType;
+
+typedef enum {
+    PlServiceType_User = 0,
+    PlServiceType_System = 1,
+} PlServiceType;
+
+typedef struct {
+    u32 type;
+    u32 offset;
+    u32 size;
+    void* address;
+} PlFontData;
+
+typedef struct {
+    u64 buttons_cur;
+    u64 buttons_old;
+} PadState;
+
+static inline Result romfsInit(void) {
+    return 1;
+}
+static inline Result romfsExit(void) {
+    return 0;
+}
+static inline Result plInitialize(PlServiceType service_type) {
+    return 1;
+}
+static inline void plExit(void) {}
+static inline Result plGetSharedFontByType(PlFontData* font, PlSharedFontType shared_font_type) {
+    return 1;
+}
+static inline void padConfigureInput(u32 max_players, u32 style_set) {}
+static inline void padInitializeWithMask(PadState* pad, u64 mask) {
+    pad->buttons_cur = 0;
+    pad->buttons_old = 0;
+}
+static inline void padUpdate(PadState* pad) {}
+static inline u64 padGetButtons(const PadState* pad) {
+    return pad->buttons_cur;
+}
+static inline u64 padGetButtonsDown(const PadState* pad) {
+    return pad->buttons_cur & ~pad->buttons_old;
+}
+static inline u64 padGetButtonsUp(const PadState* pad) {
+    return ~pad->buttons_cur & pad->buttons_old;
+}
+
+// What the logger needs. There's no nxlink, so Logger::Initialize() leaves logging off and tests log to a file
+// through Logger::Initialize(FILE*).
+typedef u32 Handle;
+#define CUR_PROCESS_HANDLE 0xFFFF8001
+
+typedef enum {
+    InfoType_TotalMemorySize = 6,
+    InfoType_UsedMemorySize = 7,
+} InfoType;
+
+static inline Result socketInitializeDefault(void) {
+    return 1;
+}
+static inline void socketExit(void) {}
+static inline int nxlinkStdio(void) {
+    return -1;
+}
+static inline void svcSleepThread(s64 nano) {}
+static inline Result svcGetInfo(u64* out, u32 id0, Handle handle, u64 id1) {
+    *out = 0;
+    return 0;
+}
@@ -0,0 +1,15 @@
+#pragma once
+
+// The libnx integer types, for building tests on a PC. Plain C, since Plutonium's TTF code includes it too.
+#include <stdint.h>
+
+typedef uint8_t u8;
+typedef uint16_t u16;
+typedef uint32_t u32;
+typedef uint64_t u64;
+typedef int8_t s8;
+typedef int16_t s16;
+typedef int32_t s32;
+typedef int64_t s64;
+
+typedef u32 Result;
@@ -0,0 +1,105 @@
+#!/usr/bin/env python3
+"""Packs the Pokemon sprites listed in data.json into atlas pages plus a binary index.
+
+PokemonSpriteManager loads the index at startup and renders sprites as regions of the pages, so a
+box of sprites costs one image load per page rather than one per sprite.
+
+Index layout, little endian:
+    "PKSA" magic, u16 version, u16 page count, u32 entry count
+    per entry, sorted by (species, form, shiny):
+        u16 species, u8 form, u8 shiny, u16 page, u16 x, u16 y, u16 width, u16 height
+
+Pages are written next to the index as <index name>_<page>.png.
+
+Usage:
+    python3 tools/pack_sprite_atlas.py [--romfs romfs] [--page-size 2048]
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+from PIL import Image
+
+MAGIC = b"PKSA"
+VERSION = 1
+# Transparent gap around each sprite so filtering never samples a neighbour
+PADDING = 1
+
+
+def romfs_path(romfs_dir, path):
+    if path.startswith("romfs:/"):
+        return os.path.join(romfs_dir, path[len("romfs:/"):])
+    return os.path.join(romfs_dir, "gfx", "data", "sprites", path)
+
+
+def load_entries(romfs_dir, metadata_path):
+    with open(metadata_path, encoding="utf-8") as f:
+        metadata = json.load(f)
+
+    entries = {}
+    for entry in metadata["pokemon"]:
+        if entry.get("skip", False) or "file_path" not in entry:
+            continue
+        key = (entry["id"], entry.get("form_id", 0), 1 if entry.get("shiny", False) else 0)
+        # Later entries replace earlier ones, matching the JSON loader
+        entries[key] = romfs_path(romfs_dir, entry["file_path"])
+    return entries
+
+
+def pack(images, page_size):
+    """Shelf-packs images, tallest first. Returns {path: (page, x, y)} and the page count."""
+    placements = {}
+    page, x, y, shelf_height = 0, 0, 0, 0
+    for path, image in sorted(images.items(), key=lambda item: (-item[1].height, item[0])):
+        width, height = image.width + PADDING * 2, image.height + PADDING * 2
+        if width > page_size or height > page_size:
+            sys.exit(f"{path} is larger than the {page_size}x{page_size} page size")
+        if x + width > page_size:
+            x, y, shelf_height = 0, y + shelf_height, 0
+        if y + height > page_size:
+            page, x, y, shelf_height = page + 1, 0, 0, 0
+        placements[path] = (page, x + PADDING, y + PADDING)
+        x += width
+        shelf_height = max(shelf_height, height)
+    return placements, page + 1 if placements else 0
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--romfs", default="romfs", help="romfs directory sprite paths are relative to")
+    parser.add_argument("--metadata", help="sprite metadata, defaults to <romfs>/gfx/data/data.json")
+    parser.add_argument("--output", help="index to write, defaults to <romfs>/gfx/data/sprite_atlas.bin")
+    parser.add_argument("--page-size", type=int, default=2048, help="width and height of each page")
+    args = parser.parse_args()
+
+    metadata_path = args.metadata or os.path.join(args.romfs, "gfx", "data", "data.json")
+    output_path = args.output or os.path.join(args.romfs, "gfx", "data", "sprite_atlas.bin")
+
+    entries = load_entries(args.romfs, metadata_path)
+    # Sprites shared by several entries are only packed once
+    images = {path: Image.open(path).convert("RGBA") for path in set(entries.values())}
+    placements, page_count = pack(images, args.page_size)
+
+    pages = [Image.new("RGBA", (args.page_size, args.page_size)) for _ in range(page_count)]
+    for path, (page, x, y) in placements.items():
+        pages[page].paste(images[path], (x, y))
+
+    base_path = os.path.splitext(output_path)[0]
+    for i, page in enumerate(pages):
+        page.save(f"{base_path}_{i}.png", optimize=True)
+
+    with open(output_path, "wb") as f:
+        f.write(MAGIC + struct.pack("<HHI", VERSION, page_count, len(entries)))
+        for (species, form, shiny), path in sorted(entries.items()):
+            page, x, y = placements[path]
+            image = images[path]
+            f.write(struct.pack("<HBBHHHHH", species, form, shiny, page, x, y, image.width, image.height))
+
+    print(f"Packed {len(entries)} sprites ({len(images)} images) into {page_count} pages")
+
+
+if __name__ == "__main__":
+    main()
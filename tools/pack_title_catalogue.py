@@ -0,0 +1,71 @@
+#!/usr/bin/env python3
+"""Precompiles the console titles listed in data.json into a binary title catalogue.
+
+TitleCatalogue loads it at startup instead of parsing data.json, most of which is sprite metadata
+the catalogue doesn't need.
+
+Catalogue layout, little endian:
+    "PKTC" magic, u16 version, u16 entry count
+    per entry, in data.json order:
+        u64 title id, then name, icon path and main save file, each a u16 length and UTF-8 bytes
+
+Usage:
+    python3 tools/pack_title_catalogue.py [--romfs romfs]
+"""
+
+import argparse
+import json
+import os
+import struct
+import sys
+
+MAGIC = b"PKTC"
+VERSION = 1
+
+
+def pack_string(value):
+    data = value.encode("utf-8")
+    if len(data) > 0xFFFF:
+        sys.exit(f"String too long for the catalogue: {value[:32]}...")
+    return struct.pack("<H", len(data)) + data
+
+
+def load_titles(metadata_path):
+    with open(metadata_path, encoding="utf-8") as f:
+        metadata = json.load(f)
+
+    titles = []
+    for game in metadata["games"]:
+        if game.get("category") != "console":
+            continue
+        try:
+            title_id = int(game["title_id"], 16)
+        except ValueError:
+            # Skipped by the JSON loader too
+            continue
+        titles.append((title_id, game["name"], game["icon_path"], game.get("main_save_file", "")))
+    return titles
+
+
+def main():
+    parser = argparse.ArgumentParser(description=__doc__.splitlines()[0])
+    parser.add_argument("--romfs", default="romfs", help="romfs directory")
+    parser.add_argument("--metadata", help="title metadata, defaults to <romfs>/gfx/data/data.json")
+    parser.add_argument("--output", help="catalogue to write, defaults to <romfs>/gfx/data/title_catalogue.bin")
+    args = parser.parse_args()
+
+    metadata_path = args.metadata or os.path.join(args.romfs, "gfx", "data", "data.json")
+    output_path = args.output or os.path.join(args.romfs, "gfx", "data", "title_catalogue.bin")
+
+    titles = load_titles(metadata_path)
+    with open(output_path, "wb") as f:
+        f.write(MAGIC + struct.pack("<HH", VERSION, len(titles)))
+        for title_id, name, icon_path, main_save_file in titles:
+            f.write(struct.pack("<Q", title_id))
+            f.write(pack_string(name) + pack_string(icon_path) + pack_string(main_save_file))
+
+    print(f"Packed {len(titles)} titles")
+
+
+if __name__ == "__main__":
+    main()